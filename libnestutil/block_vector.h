@@ -23,6 +23,7 @@
 #ifndef BLOCK_VECTOR_H_
 #define BLOCK_VECTOR_H_
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <iostream>
@@ -211,6 +212,27 @@ public:
    */
   void push_back( const value_type_& value );
 
+  /**
+   * @brief Add a range of data to the end of the BlockVector.
+   * @param first Iterator pointing to the first element to be added.
+   * @param last Iterator pointing one past the last element to be added.
+   *
+   * Copies the elements in the range [first, last) block by block to the
+   * end of the BlockVector. Blocks needed for the range are created before
+   * any element is copied.
+   */
+  template < typename ForwardIt >
+  void append( ForwardIt first, ForwardIt last );
+
+  /**
+   * @brief Create the blocks needed to hold a number of elements.
+   * @param n Number of elements.
+   *
+   * Subsequent additions of up to n elements in total do not create blocks.
+   * Neither the size nor the elements of the BlockVector are changed.
+   */
+  void reserve( const size_t n );
+
   /**
    * Erases all the elements.
    */
@@ -341,7 +363,9 @@ inline void
 BlockVector< value_type_ >::push_back( const value_type_& value )
 {
   // If this is the last element in the current block, add another block
-  if ( finish_.block_it_ == finish_.current_block_end_ - 1 )
+  // unless it has been reserved already
+  if ( finish_.block_it_ == finish_.current_block_end_ - 1
+    and finish_.block_index_ + 1 == blockmap_.size() )
   {
     blockmap_.emplace_back( max_block_size );
   }
@@ -349,6 +373,54 @@ BlockVector< value_type_ >::push_back( const value_type_& value )
   ++finish_;
 }
 
+template < typename value_type_ >
+template < typename ForwardIt >
+inline void
+BlockVector< value_type_ >::append( ForwardIt first, ForwardIt last )
+{
+  size_t num_remaining = std::distance( first, last );
+  reserve( size() + num_remaining );
+
+  while ( num_remaining > 0 )
+  {
+    auto& block = blockmap_[ finish_.block_index_ ];
+    auto block_it = block.begin() + ( finish_.block_it_ - block.begin() );
+    const size_t num_copied = std::min( num_remaining,
+      static_cast< size_t >( finish_.current_block_end_ - finish_.block_it_ ) );
+
+    ForwardIt block_last = first;
+    std::advance( block_last, num_copied );
+    finish_.block_it_ = std::copy( first, block_last, block_it );
+    first = block_last;
+    num_remaining -= num_copied;
+
+    // Move on to the next block, which has been created by reserve()
+    if ( finish_.block_it_ == finish_.current_block_end_ )
+    {
+      ++finish_.block_index_;
+      finish_.block_it_ = blockmap_[ finish_.block_index_ ].begin();
+      finish_.current_block_end_ = blockmap_[ finish_.block_index_ ].end();
+    }
+  }
+}
+
+template < typename value_type_ >
+inline void
+BlockVector< value_type_ >::reserve( const size_t n )
+{
+  // The block following the last element must exist, so a full final block
+  // needs an empty block after it.
+  const size_t num_blocks_needed = n / max_block_size + 1;
+  if ( blockmap_.size() < num_blocks_needed )
+  {
+    blockmap_.reserve( num_blocks_needed );
+  }
+  while ( blockmap_.size() < num_blocks_needed )
+  {
+    blockmap_.emplace_back( max_block_size );
+  }
+}
+
 template < typename value_type_ >
 inline void
 BlockVector< value_type_ >::clear()
@@ -0,0 +1,60 @@
+/*
+ *  numa_utils.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "numa_utils.h"
+
+// C includes:
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+int
+nest::numa_node_of_current_cpu()
+{
+#if defined( __linux__ ) && defined( SYS_getcpu )
+  unsigned int cpu;
+  unsigned int node;
+  if ( syscall( SYS_getcpu, &cpu, &node, 0 ) == 0 )
+  {
+    return node;
+  }
+#endif
+  return -1;
+}
+
+int
+nest::numa_node_of_address( const void* addr )
+{
+#if defined( __linux__ ) && defined( SYS_get_mempolicy )
+  // MPOL_F_NODE | MPOL_F_ADDR, see get_mempolicy(2); the flags are defined
+  // here to avoid depending on libnuma
+  const unsigned long flags = 1 | 2;
+  int node;
+  if ( addr != 0
+    and syscall( SYS_get_mempolicy, &node, 0, 0, addr, flags ) == 0 )
+  {
+    return node;
+  }
+#endif
+  return -1;
+}
@@ -0,0 +1,46 @@
+/*
+ *  numa_utils.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef NUMA_UTILS_H
+#define NUMA_UTILS_H
+
+namespace nest
+{
+
+/**
+ * Return the NUMA node of the CPU the calling thread is running on.
+ *
+ * Returns -1 if the information is not available on this system.
+ */
+int numa_node_of_current_cpu();
+
+/**
+ * Return the NUMA node on which the memory at address addr is placed.
+ *
+ * The memory must have been touched already. Returns -1 if the
+ * information is not available on this system.
+ */
+int numa_node_of_address( const void* addr );
+
+} // namespace nest
+
+#endif /* NUMA_UTILS_H */
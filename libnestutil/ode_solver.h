@@ -0,0 +1,508 @@
+/*
+ *  ode_solver.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ODE_SOLVER_H
+#define ODE_SOLVER_H
+
+// C++ includes:
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+
+namespace nest
+{
+
+/**
+ * Solvers for systems of ordinary differential equations of neuron models.
+ *
+ * The solvers are templates on the dimension N of the state vector, so that
+ * all temporaries live on the stack and the right-hand side, passed as a
+ * function object, can be inlined. A system must provide
+ *
+ *   void operator()( double t, const double y[], double f[] ) const;
+ *
+ * computing the derivative f of the state y at time t. All solvers offer
+ *
+ *   template < typename System >
+ *   void evolve( const System& sys, double& t, double t1, double& h,
+ *     double y[] );
+ *
+ * which, like gsl_odeiv_evolve_apply(), performs a single integration step
+ * of size h from t towards t1, never stepping past t1, and advances t.
+ * Adaptive solvers update the step size h for the next call, unless the
+ * step was shortened to end at t1.
+ *
+ * Several instances of a system of dimension N can be integrated with a
+ * shared step size by passing a system of dimension N * L to a solver,
+ * where element i * L + l of the state holds component i of instance l.
+ * The element-wise loops of the solvers then run over consecutive
+ * instances and can be vectorized, and RKF45 accepts a step only if the
+ * error of all instances is admissible, i.e., the step size is the
+ * smallest of the step sizes the instances would use individually.
+ */
+namespace ode
+{
+
+/**
+ * Number of instances integrated together by batched model updates,
+ * chosen such that the lanes fill the vector registers of the target.
+ */
+#ifdef __AVX512F__
+const size_t batch_lanes = 8;
+#else
+const size_t batch_lanes = 4;
+#endif
+
+/**
+ * Step size control based on the local error estimate, equivalent to
+ * gsl_odeiv_control_standard_new().
+ *
+ * The step is accepted if for each component i the error is below
+ *   eps_abs + eps_rel * ( a_y * |y_i| + a_dydt * h * |dy_i/dt| ).
+ */
+class StepControl
+{
+public:
+  //! Return value of adjust()
+  enum Adjustment
+  {
+    DECREASE = -1,
+    NONE = 0,
+    INCREASE = 1
+  };
+
+  StepControl( const double eps_abs,
+    const double eps_rel,
+    const double a_y,
+    const double a_dydt );
+
+  //! Control on the state, as gsl_odeiv_control_y_new()
+  static StepControl y( const double eps_abs, const double eps_rel );
+
+  //! Control on the derivative, as gsl_odeiv_control_yp_new()
+  static StepControl yp( const double eps_abs, const double eps_rel );
+
+  //! Return true if the derivative at the end of a step is required
+  bool
+  uses_dydt() const
+  {
+    return a_dydt_ != 0.0;
+  }
+
+  /**
+   * Propose new step size h for a solver of given order, based on the
+   * error yerr of a step of size h resulting in y.
+   */
+  template < size_t N >
+  Adjustment adjust( const int order,
+    const double y[],
+    const double yerr[],
+    const double dydt[],
+    double& h ) const;
+
+private:
+  double eps_abs_;
+  double eps_rel_;
+  double a_y_;
+  double a_dydt_;
+};
+
+inline StepControl::StepControl( const double eps_abs,
+  const double eps_rel,
+  const double a_y,
+  const double a_dydt )
+  : eps_abs_( eps_abs )
+  , eps_rel_( eps_rel )
+  , a_y_( a_y )
+  , a_dydt_( a_dydt )
+{
+}
+
+inline StepControl
+StepControl::y( const double eps_abs, const double eps_rel )
+{
+  return StepControl( eps_abs, eps_rel, 1.0, 0.0 );
+}
+
+inline StepControl
+StepControl::yp( const double eps_abs, const double eps_rel )
+{
+  return StepControl( eps_abs, eps_rel, 0.0, 1.0 );
+}
+
+template < size_t N >
+StepControl::Adjustment
+StepControl::adjust( const int order,
+  const double y[],
+  const double yerr[],
+  const double dydt[],
+  double& h ) const
+{
+  const double safety = 0.9;
+  const double h_old = h;
+
+  double rmax = DBL_MIN;
+  for ( size_t i = 0; i < N; ++i )
+  {
+    const double D0 = eps_rel_ * ( a_y_ * std::abs( y[ i ] )
+                                   + a_dydt_ * std::abs( h_old * dydt[ i ] ) )
+      + eps_abs_;
+    rmax = std::max( rmax, std::abs( yerr[ i ] ) / std::abs( D0 ) );
+  }
+
+  if ( rmax > 1.1 )
+  {
+    // decrease step, no more than factor of 5
+    const double r = safety / std::pow( rmax, 1.0 / order );
+    h = std::max( r, 0.2 ) * h_old;
+    return DECREASE;
+  }
+  else if ( rmax < 0.5 )
+  {
+    // increase step, no more than factor of 5
+    const double r = safety / std::pow( rmax, 1.0 / ( order + 1.0 ) );
+    h = std::min( std::max( r, 1.0 ), 5.0 ) * h_old;
+    return INCREASE;
+  }
+  return NONE;
+}
+
+/**
+ * Embedded Runge-Kutta-Fehlberg (4, 5) method with adaptive step size,
+ * equivalent to gsl_odeiv_step_rkf45 driven by gsl_odeiv_evolve_apply().
+ */
+template < size_t N >
+class RKF45
+{
+public:
+  static const int order = 5;
+
+  explicit RKF45( const StepControl& control );
+
+  //! Set the step size control
+  void set_control( const StepControl& control );
+
+  template < typename System >
+  void evolve( const System& sys,
+    double& t,
+    const double t1,
+    double& h,
+    double y[] ) const;
+
+private:
+  //! Single step of size h from y0 with derivative k1 at t
+  template < typename System >
+  void step_( const System& sys,
+    const double t,
+    const double h,
+    const double y0[],
+    const double k1[],
+    double y[],
+    double yerr[] ) const;
+
+  StepControl control_;
+};
+
+template < size_t N >
+RKF45< N >::RKF45( const StepControl& control )
+  : control_( control )
+{
+}
+
+template < size_t N >
+void
+RKF45< N >::set_control( const StepControl& control )
+{
+  control_ = control;
+}
+
+template < size_t N >
+template < typename System >
+void
+RKF45< N >::evolve( const System& sys,
+  double& t,
+  const double t1,
+  double& h,
+  double y[] ) const
+{
+  const double t0 = t;
+  double y0[ N ];
+  std::copy( y, y + N, y0 );
+
+  double dydt_in[ N ];
+  double dydt_out[ N ];
+  double yerr[ N ];
+  sys( t0, y0, dydt_in );
+  std::fill( dydt_out, dydt_out + N, 0.0 );
+
+  double h0 = h;
+  bool final_step = false;
+  if ( h0 > t1 - t0 )
+  {
+    h0 = t1 - t0;
+    final_step = true;
+  }
+
+  while ( true )
+  {
+    step_( sys, t0, h0, y0, dydt_in, y, yerr );
+    t = final_step ? t1 : t0 + h0;
+
+    if ( control_.uses_dydt() )
+    {
+      sys( t, y, dydt_out );
+    }
+
+    const double h_old = h0;
+    if ( control_.adjust< N >( order, y, yerr, dydt_out, h0 )
+      == StepControl::DECREASE )
+    {
+      // retry with smaller step unless it no longer advances time
+      if ( h0 < h_old and t0 + h0 != t0 )
+      {
+        final_step = false;
+        continue;
+      }
+      h0 = h_old;
+    }
+    break;
+  }
+
+  // a final step shortened to reach t1 does not determine the step size
+  // for the next call
+  if ( not final_step )
+  {
+    h = h0;
+  }
+}
+
+template < size_t N >
+template < typename System >
+void
+RKF45< N >::step_( const System& sys,
+  const double t,
+  const double h,
+  const double y0[],
+  const double k1[],
+  double y[],
+  double yerr[] ) const
+{
+  // Butcher tableau of the Fehlberg method
+  const double ah[] = { 1.0 / 4.0, 3.0 / 8.0, 12.0 / 13.0, 1.0, 1.0 / 2.0 };
+  const double b21 = 1.0 / 4.0;
+  const double b3[] = { 3.0 / 32.0, 9.0 / 32.0 };
+  const double b4[] = { 1932.0 / 2197.0, -7200.0 / 2197.0, 7296.0 / 2197.0 };
+  const double b5[] = {
+    8341.0 / 4104.0, -32832.0 / 4104.0, 29440.0 / 4104.0, -845.0 / 4104.0
+  };
+  const double b6[] = { -6080.0 / 20520.0,
+    41040.0 / 20520.0,
+    -28352.0 / 20520.0,
+    9295.0 / 20520.0,
+    -5643.0 / 20520.0 };
+
+  // fifth order solution
+  const double c1 = 902880.0 / 7618050.0;
+  const double c3 = 3953664.0 / 7618050.0;
+  const double c4 = 3855735.0 / 7618050.0;
+  const double c5 = -1371249.0 / 7618050.0;
+  const double c6 = 277020.0 / 7618050.0;
+
+  // difference between fourth and fifth order solutions
+  const double ec1 = 1.0 / 360.0;
+  const double ec3 = -128.0 / 4275.0;
+  const double ec4 = -2197.0 / 75240.0;
+  const double ec5 = 1.0 / 50.0;
+  const double ec6 = 2.0 / 55.0;
+
+  double k2[ N ];
+  double k3[ N ];
+  double k4[ N ];
+  double k5[ N ];
+  double k6[ N ];
+  double ytmp[ N ];
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    ytmp[ i ] = y0[ i ] + b21 * h * k1[ i ];
+  }
+  sys( t + ah[ 0 ] * h, ytmp, k2 );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    ytmp[ i ] = y0[ i ] + h * ( b3[ 0 ] * k1[ i ] + b3[ 1 ] * k2[ i ] );
+  }
+  sys( t + ah[ 1 ] * h, ytmp, k3 );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    ytmp[ i ] = y0[ i ]
+      + h * ( b4[ 0 ] * k1[ i ] + b4[ 1 ] * k2[ i ] + b4[ 2 ] * k3[ i ] );
+  }
+  sys( t + ah[ 2 ] * h, ytmp, k4 );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    ytmp[ i ] = y0[ i ]
+      + h * ( b5[ 0 ] * k1[ i ] + b5[ 1 ] * k2[ i ] + b5[ 2 ] * k3[ i ]
+              + b5[ 3 ] * k4[ i ] );
+  }
+  sys( t + ah[ 3 ] * h, ytmp, k5 );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    ytmp[ i ] = y0[ i ]
+      + h * ( b6[ 0 ] * k1[ i ] + b6[ 1 ] * k2[ i ] + b6[ 2 ] * k3[ i ]
+              + b6[ 3 ] * k4[ i ] + b6[ 4 ] * k5[ i ] );
+  }
+  sys( t + ah[ 4 ] * h, ytmp, k6 );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    y[ i ] = y0[ i ]
+      + h * ( c1 * k1[ i ] + c3 * k3[ i ] + c4 * k4[ i ] + c5 * k5[ i ]
+              + c6 * k6[ i ] );
+    yerr[ i ] = h * ( ec1 * k1[ i ] + ec3 * k3[ i ] + ec4 * k4[ i ]
+                      + ec5 * k5[ i ] + ec6 * k6[ i ] );
+  }
+}
+
+/**
+ * Classical fourth order Runge-Kutta method with fixed step size.
+ */
+template < size_t N >
+class RK4
+{
+public:
+  static const int order = 4;
+
+  template < typename System >
+  void evolve( const System& sys,
+    double& t,
+    const double t1,
+    double& h,
+    double y[] ) const;
+};
+
+template < size_t N >
+template < typename System >
+void
+RK4< N >::evolve( const System& sys,
+  double& t,
+  const double t1,
+  double& h,
+  double y[] ) const
+{
+  const bool final_step = h >= t1 - t;
+  const double h0 = final_step ? t1 - t : h;
+
+  double k1[ N ];
+  double k2[ N ];
+  double k3[ N ];
+  double k4[ N ];
+  double ytmp[ N ];
+
+  sys( t, y, k1 );
+  for ( size_t i = 0; i < N; ++i )
+  {
+    ytmp[ i ] = y[ i ] + 0.5 * h0 * k1[ i ];
+  }
+  sys( t + 0.5 * h0, ytmp, k2 );
+  for ( size_t i = 0; i < N; ++i )
+  {
+    ytmp[ i ] = y[ i ] + 0.5 * h0 * k2[ i ];
+  }
+  sys( t + 0.5 * h0, ytmp, k3 );
+  for ( size_t i = 0; i < N; ++i )
+  {
+    ytmp[ i ] = y[ i ] + h0 * k3[ i ];
+  }
+  sys( t + h0, ytmp, k4 );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    y[ i ] += h0 / 6.0 * ( k1[ i ] + 2.0 * k2[ i ] + 2.0 * k3[ i ] + k4[ i ] );
+  }
+
+  t = final_step ? t1 : t + h0;
+}
+
+/**
+ * Exponential Euler method with fixed step size.
+ *
+ * Each component is integrated exactly under the assumption that its
+ * derivative depends linearly on the component itself, which makes the
+ * method stable for the fast decaying variables of conductance-based
+ * models. The system must in addition provide
+ *
+ *   void linear( double t, const double y[], double a[] ) const;
+ *
+ * returning the diagonal a of the Jacobian, i.e., a_i = df_i/dy_i.
+ */
+template < size_t N >
+class ExponentialEuler
+{
+public:
+  static const int order = 1;
+
+  template < typename System >
+  void evolve( const System& sys,
+    double& t,
+    const double t1,
+    double& h,
+    double y[] ) const;
+};
+
+template < size_t N >
+template < typename System >
+void
+ExponentialEuler< N >::evolve( const System& sys,
+  double& t,
+  const double t1,
+  double& h,
+  double y[] ) const
+{
+  const bool final_step = h >= t1 - t;
+  const double h0 = final_step ? t1 - t : h;
+
+  double f[ N ];
+  double a[ N ];
+  sys( t, y, f );
+  sys.linear( t, y, a );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    // y_i + f_i * ( exp( a_i * h ) - 1 ) / a_i, with limit f_i * h for a_i = 0
+    const double ah = a[ i ] * h0;
+    y[ i ] += std::abs( ah ) < DBL_EPSILON ? f[ i ] * h0
+                                           : f[ i ] * std::expm1( ah ) / a[ i ];
+  }
+
+  t = final_step ? t1 : t + h0;
+}
+
+} // namespace ode
+
+} // namespace nest
+
+#endif /* ODE_SOLVER_H */
@@ -23,48 +23,46 @@
 #ifndef SORT_H
 #define SORT_H
 
+#include <algorithm>
+#include <cassert>
 #include <cstddef>
+#include <stdint.h>
 #include <vector>
 
 #include "block_vector.h"
 
-#define INSERTION_SORT_CUTOFF 10 // use insertion sort for smaller arrays
+#define RADIX_SORT_BITS 11   // number of key bits sorted per radix pass
+#define RADIX_SORT_CUTOFF 32 // use insertion sort for smaller ranges
 
 namespace nest
 {
+
 /**
- * Calculates the median of three elements.
- * See http://algs4.cs.princeton.edu/23quicksort/QuickX.java.html.
+ * Returns the integer key by which radix_sort_() orders elements.
+ * Overloads for other element types, e.g., Source, are found by
+ * argument-dependent lookup.
  */
-template < typename T >
-inline size_t
-median3_( const BlockVector< T >& vec,
-  const size_t i,
-  const size_t j,
-  const size_t k )
+inline uint64_t
+radix_key( const size_t value )
 {
-  return ( ( vec[ i ] < vec[ j ] )
-      ? ( ( vec[ j ] < vec[ k ] ) ? j : ( vec[ i ] < vec[ k ] ) ? k : i )
-      : ( ( vec[ k ] < vec[ j ] ) ? j : ( vec[ k ] < vec[ i ] ) ? k : i ) );
+  return value;
 }
 
 /**
- * Insertion sort, adapted from Sedgewick & Wayne
- * (2011), Algorithms 4th edition, p251ff.
- * Sorts the two vectors vec_sort and vec_perm, by sorting the
- * entries in vec_sort and applying the same exchanges to
- * vec_perm.
+ * Insertion sort of the entries in [lo, hi) of two vectors by the keys
+ * of the first vector, used for small ranges in radix_sort_().
  */
 template < typename T1, typename T2 >
 void
-insertion_sort( BlockVector< T1 >& vec_sort,
+insertion_sort_( BlockVector< T1 >& vec_sort,
   BlockVector< T2 >& vec_perm,
   const size_t lo,
   const size_t hi )
 {
-  for ( size_t i = lo + 1; i < hi + 1; ++i )
+  for ( size_t i = lo + 1; i < hi; ++i )
   {
-    for ( size_t j = i; ( j > lo ) and ( vec_sort[ j ] < vec_sort[ j - 1 ] );
+    for ( size_t j = i; j > lo
+          and radix_key( vec_sort[ j ] ) < radix_key( vec_sort[ j - 1 ] );
           --j )
     {
       std::swap( vec_sort[ j ], vec_sort[ j - 1 ] );
@@ -74,106 +72,194 @@ insertion_sort( BlockVector< T1 >& vec_sort,
 }
 
 /**
- * Quicksort with 3-way partitioning, adapted from Sedgewick & Wayne
- * (2011), Algorithms 4th edition, p296ff
- * (see http://algs4.cs.princeton.edu/23quicksort/QuickX.java.html).
- *
- * Recursively sorts the two vectors vec_sort and vec_perm, by
- * sorting the entries in vec_sort and applying the same exchanges
- * to vec_perm.
+ * In-place most-significant-digit radix sort (American flag sort) of
+ * the entries in [lo, hi) of two vectors by the keys given by
+ * radix_key() for the first vector, starting with the digit at the
+ * given shift. Entries are moved into the buckets of the digit by
+ * cycles of swaps, so both vectors are sorted without additional
+ * memory per entry. Each bucket is then sorted by the next lower digit.
+ * The bucket boundaries of each digit are kept in the section of
+ * buckets for that digit, see sort_from(), which is reused by all calls
+ * at the same depth of the recursion. The sort is not stable.
  */
 template < typename T1, typename T2 >
 void
-quicksort3way( BlockVector< T1 >& vec_sort,
+radix_sort_( BlockVector< T1 >& vec_sort,
   BlockVector< T2 >& vec_perm,
   const size_t lo,
-  const size_t hi )
+  const size_t hi,
+  const unsigned int shift,
+  std::vector< size_t >& buckets )
 {
-  if ( lo >= hi )
+  if ( hi - lo <= RADIX_SORT_CUTOFF )
   {
+    insertion_sort_( vec_sort, vec_perm, lo, hi );
     return;
   }
 
-  const size_t n = hi - lo + 1;
+  const size_t num_buckets = 1 << RADIX_SORT_BITS;
+  const uint64_t mask = num_buckets - 1;
+
+  // heads[ b ] is the next position to fill in bucket b, which ends at
+  // ends[ b ]
+  size_t* const heads =
+    &buckets[ ( shift / RADIX_SORT_BITS ) * 2 * ( num_buckets + 1 ) ];
+  size_t* const ends = heads + num_buckets + 1;
+  std::fill( heads, heads + num_buckets + 1, 0 );
+  for ( size_t i = lo; i < hi; ++i )
+  {
+    ++heads[ ( ( radix_key( vec_sort[ i ] ) >> shift ) & mask ) + 1 ];
+  }
+  heads[ 0 ] = lo;
+  for ( size_t b = 1; b <= num_buckets; ++b )
+  {
+    heads[ b ] += heads[ b - 1 ];
+  }
+  std::copy( heads + 1, heads + num_buckets + 1, ends );
+
+  // nothing to exchange if all entries have the same digit
+  const size_t b_lo = ( radix_key( vec_sort[ lo ] ) >> shift ) & mask;
+  if ( ends[ b_lo ] - heads[ b_lo ] < hi - lo )
+  {
+    for ( size_t b = 0; b < num_buckets; ++b )
+    {
+      while ( heads[ b ] < ends[ b ] )
+      {
+        const size_t d =
+          ( radix_key( vec_sort[ heads[ b ] ] ) >> shift ) & mask;
+        if ( d == b )
+        {
+          ++heads[ b ];
+        }
+        else
+        {
+          std::swap( vec_sort[ heads[ b ] ], vec_sort[ heads[ d ] ] );
+          std::swap( vec_perm[ heads[ b ] ], vec_perm[ heads[ d ] ] );
+          ++heads[ d ];
+        }
+      }
+    }
+  }
 
-  // switch to insertion sort for small arrays
-  if ( n <= INSERTION_SORT_CUTOFF )
+  if ( shift == 0 )
   {
-    insertion_sort( vec_sort, vec_perm, lo, hi );
     return;
   }
+  size_t begin = lo;
+  for ( size_t b = 0; b < num_buckets; ++b )
+  {
+    radix_sort_( vec_sort,
+      vec_perm,
+      begin,
+      ends[ b ],
+      shift - RADIX_SORT_BITS,
+      buckets );
+    begin = ends[ b ];
+  }
+}
 
-  // use median-of-3 as partitioning element
-  size_t m = median3_( vec_sort, lo, lo + n / 2, hi );
+/**
+ * Sorts the entries of two vectors from position first on according to
+ * the elements in the first vector, using radix_sort_(). Entries in
+ * front of first are not moved, so the result consists of two
+ * separately sorted segments.
+ */
+template < typename T1, typename T2 >
+void
+sort_from( BlockVector< T1 >& vec_sort,
+  BlockVector< T2 >& vec_perm,
+  const size_t first )
+{
+  assert( first <= vec_sort.size() );
+  const size_t n = vec_sort.size();
 
-  // in case of many equal entries, make sure to use first entry with
-  // this value (useful for sorted arrays)
-  const T1 m_val = vec_sort[ m ];
-  while ( m > 0 and vec_sort[ m - 1 ] == m_val )
+  // start with the most significant non-zero digit of the largest key
+  uint64_t max_key = 0;
+  for ( size_t i = first; i < n; ++i )
   {
-    --m;
+    max_key = std::max( max_key, radix_key( vec_sort[ i ] ) );
   }
+  unsigned int shift = 0;
+  while ( shift + RADIX_SORT_BITS < 64
+    and ( max_key >> ( shift + RADIX_SORT_BITS ) ) > 0 )
+  {
+    shift += RADIX_SORT_BITS;
+  }
+
+  // heads and ends of the buckets for each digit
+  std::vector< size_t > buckets(
+    ( shift / RADIX_SORT_BITS + 1 ) * 2 * ( ( 1 << RADIX_SORT_BITS ) + 1 ) );
+  radix_sort_( vec_sort, vec_perm, first, n, shift, buckets );
+}
 
-  // move pivot to the front
-  std::swap( vec_sort[ m ], vec_sort[ lo ] );
-  std::swap( vec_perm[ m ], vec_perm[ lo ] );
+/**
+ * Sorts two vectors according to elements in first vector.
+ *
+ * Connections are appended to already sorted tables, so only the
+ * entries after the longest sorted prefix are sorted by sort_from() and
+ * then merged into the prefix from the back. Only the appended entries
+ * are buffered during the merge, and entries in front of the first
+ * position at which an appended entry is inserted are not moved. The
+ * sort is not stable: equal elements of the prefix stay in front of
+ * equal appended elements, but the order of equal appended elements is
+ * not preserved.
+ */
+template < typename T1, typename T2 >
+void
+sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm )
+{
+  const size_t n = vec_sort.size();
 
-  // Dijkstra's three-way-sort
-  size_t lt = lo;
-  size_t i = lo + 1;
-  size_t gt = hi;
-  const T1 v = vec_sort[ lt ]; // pivot
+  size_t num_sorted = 1;
+  while ( num_sorted < n
+    and not( vec_sort[ num_sorted ] < vec_sort[ num_sorted - 1 ] ) )
+  {
+    ++num_sorted;
+  }
+  if ( num_sorted >= n )
+  {
+    return;
+  }
 
-  // adjust position of i and lt (useful for sorted arrays)
-  while ( vec_sort[ i ] < v )
+  sort_from( vec_sort, vec_perm, num_sorted );
+  if ( radix_key( vec_sort[ num_sorted - 1 ] )
+    <= radix_key( vec_sort[ num_sorted ] ) )
   {
-    ++i;
+    return; // appended entries follow the prefix
   }
-  std::swap( vec_sort[ lo ], vec_sort[ i - 1 ] );
-  std::swap( vec_perm[ lo ], vec_perm[ i - 1 ] );
-  lt = i - 1;
 
-  // adjust position of gt (useful for sorted arrays)
-  while ( vec_sort[ gt ] > v )
+  const size_t num_new = n - num_sorted;
+  std::vector< T1 > new_sort;
+  std::vector< T2 > new_perm;
+  new_sort.reserve( num_new );
+  new_perm.reserve( num_new );
+  for ( size_t j = num_sorted; j < n; ++j )
   {
-    --gt;
+    new_sort.push_back( vec_sort[ j ] );
+    new_perm.push_back( vec_perm[ j ] );
   }
 
-  while ( i <= gt )
+  // merge from the back, until all appended entries are placed
+  size_t i = num_sorted;
+  size_t j = num_new;
+  size_t k = n;
+  while ( j > 0 )
   {
-    if ( vec_sort[ i ] < v )
+    --k;
+    if ( i > 0
+      and radix_key( new_sort[ j - 1 ] ) < radix_key( vec_sort[ i - 1 ] ) )
     {
-      std::swap( vec_sort[ lt ], vec_sort[ i ] );
-      std::swap( vec_perm[ lt ], vec_perm[ i ] );
-      ++lt;
-      ++i;
-    }
-    else if ( vec_sort[ i ] > v )
-    {
-      std::swap( vec_sort[ i ], vec_sort[ gt ] );
-      std::swap( vec_perm[ i ], vec_perm[ gt ] );
-      --gt;
+      --i;
+      vec_sort[ k ] = vec_sort[ i ];
+      vec_perm[ k ] = vec_perm[ i ];
     }
     else
     {
-      ++i;
+      --j;
+      vec_sort[ k ] = new_sort[ j ];
+      vec_perm[ k ] = new_perm[ j ];
     }
   }
-
-  quicksort3way( vec_sort, vec_perm, lo, lt - 1 );
-  quicksort3way( vec_sort, vec_perm, gt + 1, hi );
-}
-
-/**
- * Sorts two vectors according to elements in
- * first vector. Convenience function.
- */
-
-template < typename T1, typename T2 >
-void
-sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm )
-{
-  quicksort3way( vec_sort, vec_perm, 0, vec_sort.size() - 1 );
 }
 
 } // namespace sort
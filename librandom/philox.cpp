@@ -0,0 +1,259 @@
+/*
+ *  philox.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "philox.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+// Includes from libnestutil:
+#include "numerics.h"
+
+const uint32_t librandom::Philox::M0_ = 0xD2511F53;
+const uint32_t librandom::Philox::M1_ = 0xCD9E8D57;
+const uint32_t librandom::Philox::W0_ = 0x9E3779B9;
+const uint32_t librandom::Philox::W1_ = 0xBB67AE85;
+const double librandom::Philox::I2DFactor_ = 1.0 / 4294967296.0; // 2^-32
+
+librandom::Philox::Philox( unsigned long seed )
+  : next_block_( 0 )
+  , buffer_pos_( 4 )
+{
+  self_test_(); // minimal check
+  stream_[ 0 ] = 0;
+  stream_[ 1 ] = 0;
+  seed_( seed );
+}
+
+void
+librandom::Philox::seed_( unsigned long seed )
+{
+  const uint64_t s = seed;
+  key_[ 0 ] = static_cast< uint32_t >( s );
+  key_[ 1 ] = static_cast< uint32_t >( s >> 32 );
+  next_block_ = 0;
+  buffer_pos_ = 4;
+}
+
+void
+librandom::Philox::set_stream( const unsigned long vp,
+  const unsigned long purpose )
+{
+  stream_[ 0 ] = static_cast< uint32_t >( vp );
+  stream_[ 1 ] = static_cast< uint32_t >( purpose );
+  next_block_ = 0;
+  buffer_pos_ = 4;
+}
+
+void
+librandom::Philox::generate_( const uint64_t first_block,
+  const size_t num_blocks,
+  uint32_t* out ) const
+{
+  // iterations are independent of each other
+  for ( size_t b = 0; b < num_blocks; ++b )
+  {
+    const uint64_t block = first_block + b;
+    uint32_t c0 = static_cast< uint32_t >( block );
+    uint32_t c1 = static_cast< uint32_t >( block >> 32 );
+    uint32_t c2 = stream_[ 0 ];
+    uint32_t c3 = stream_[ 1 ];
+    uint32_t k0 = key_[ 0 ];
+    uint32_t k1 = key_[ 1 ];
+
+    for ( int round = 0; round < 10; ++round )
+    {
+      if ( round > 0 )
+      {
+        k0 += W0_;
+        k1 += W1_;
+      }
+      const uint64_t p0 = static_cast< uint64_t >( M0_ ) * c0;
+      const uint64_t p1 = static_cast< uint64_t >( M1_ ) * c2;
+      c0 = static_cast< uint32_t >( p1 >> 32 ) ^ c1 ^ k0;
+      c1 = static_cast< uint32_t >( p1 );
+      c2 = static_cast< uint32_t >( p0 >> 32 ) ^ c3 ^ k1;
+      c3 = static_cast< uint32_t >( p0 );
+    }
+
+    out[ 4 * b ] = c0;
+    out[ 4 * b + 1 ] = c1;
+    out[ 4 * b + 2 ] = c2;
+    out[ 4 * b + 3 ] = c3;
+  }
+}
+
+void
+librandom::Philox::fill_uniform( double* x, const size_t n )
+{
+  size_t i = 0;
+
+  // use up the current block first, so that the numbers are the same as
+  // for successive calls to drand()
+  for ( ; i < n and buffer_pos_ < 4; ++i )
+  {
+    x[ i ] = I2DFactor_ * buffer_[ buffer_pos_++ ];
+  }
+
+  // complete blocks, computed in chunks on the stack
+  const size_t max_blocks = 64;
+  uint32_t words[ 4 * max_blocks ];
+  while ( n - i >= 4 )
+  {
+    const size_t num_blocks = std::min( ( n - i ) / 4, max_blocks );
+    generate_( next_block_, num_blocks, words );
+    next_block_ += num_blocks;
+    for ( size_t j = 0; j < 4 * num_blocks; ++j )
+    {
+      x[ i + j ] = I2DFactor_ * words[ j ];
+    }
+    i += 4 * num_blocks;
+  }
+
+  // remaining numbers are taken from a new current block
+  for ( ; i < n; ++i )
+  {
+    x[ i ] = drand_();
+  }
+}
+
+void
+librandom::Philox::fill_normal( double* x, const size_t n )
+{
+  // Box-Muller transform of pairs of uniform numbers, the first number of
+  // each pair is mapped to (0, 1] to avoid log(0)
+  fill_uniform( x, n );
+  for ( size_t i = 0; i + 1 < n; i += 2 )
+  {
+    const double r = std::sqrt( -2.0 * std::log( 1.0 - x[ i ] ) );
+    const double phi = 2.0 * numerics::pi * x[ i + 1 ];
+    x[ i ] = r * std::cos( phi );
+    x[ i + 1 ] = r * std::sin( phi );
+  }
+
+  if ( n % 2 == 1 )
+  {
+    const double r = std::sqrt( -2.0 * std::log( 1.0 - x[ n - 1 ] ) );
+    x[ n - 1 ] = r * std::cos( 2.0 * numerics::pi * drand_() );
+  }
+}
+
+void
+librandom::Philox::fill_poisson( long* k, const size_t n, const double lambda )
+{
+  assert( lambda >= 0 );
+
+  if ( lambda >= 10.0 )
+  {
+    for ( size_t i = 0; i < n; ++i )
+    {
+      k[ i ] = poisson_ptrs_( lambda );
+    }
+    return;
+  }
+
+  // inversion by sequential search for small lambda
+  const double p0 = std::exp( -lambda );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    double u = drand_();
+    double p = p0;
+    long m = 0;
+    while ( u > p and p > 0 )
+    {
+      u -= p;
+      ++m;
+      p *= lambda / m;
+    }
+    k[ i ] = m;
+  }
+}
+
+long
+librandom::Philox::poisson_ptrs_( const double lambda )
+{
+  // Transformed rejection with squeeze, W. Hoermann (1993) The transformed
+  // rejection method for generating Poisson random variables. Insurance:
+  // Mathematics and Economics 12, 39-45.
+  const double slam = std::sqrt( lambda );
+  const double loglam = std::log( lambda );
+  const double b = 0.931 + 2.53 * slam;
+  const double a = -0.059 + 0.02483 * b;
+  const double invalpha = 1.1239 + 1.1328 / ( b - 3.4 );
+  const double vr = 0.9277 - 3.6224 / ( b - 2 );
+
+  while ( true )
+  {
+    const double u = drand_() - 0.5;
+    const double v = drand_();
+    const double us = 0.5 - std::abs( u );
+    if ( us == 0.0 )
+    {
+      continue; // u == -0.5 would yield an infinite candidate
+    }
+    const double k = std::floor( ( 2 * a / us + b ) * u + lambda + 0.43 );
+    if ( k < 0 )
+    {
+      continue;
+    }
+    const long m = static_cast< long >( k );
+
+    if ( us >= 0.07 and v <= vr )
+    {
+      return m;
+    }
+    if ( us < 0.013 and v > us )
+    {
+      continue;
+    }
+    if ( std::log( v ) + std::log( invalpha ) - std::log( a / ( us * us ) + b )
+      <= -lambda + m * loglam - std::lgamma( m + 1.0 ) )
+    {
+      return m;
+    }
+  }
+}
+
+void
+librandom::Philox::self_test_()
+{
+  // known answers from the Random123 test suite, kat_vectors
+  uint32_t out[ 4 ];
+
+  key_[ 0 ] = 0;
+  key_[ 1 ] = 0;
+  stream_[ 0 ] = 0;
+  stream_[ 1 ] = 0;
+  generate_( 0, 1, out );
+  assert( out[ 0 ] == 0x6627e8d5 and out[ 1 ] == 0xe169c58d
+    and out[ 2 ] == 0xbc57ac4c and out[ 3 ] == 0x9b00dbd8 );
+
+  key_[ 0 ] = 0xa4093822;
+  key_[ 1 ] = 0x299f31d0;
+  stream_[ 0 ] = 0x13198a2e;
+  stream_[ 1 ] = 0x03707344;
+  generate_( 0x85a308d3243f6a88ULL, 1, out );
+  assert( out[ 0 ] == 0xd16cfe09 and out[ 1 ] == 0x94fdcceb
+    and out[ 2 ] == 0x5001e420 and out[ 3 ] == 0x24126ea1 );
+}
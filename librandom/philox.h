@@ -0,0 +1,135 @@
+/*
+ *  philox.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PHILOX_H
+#define PHILOX_H
+
+// C++ includes:
+#include <cstddef>
+#include <stdint.h>
+
+// Includes from librandom:
+#include "randomgen.h"
+
+namespace librandom
+{
+
+/**
+ * Counter-based random generator Philox4x32-10.
+ *
+ * This class implements the Philox4x32 generator with 10 rounds by
+ * Salmon, Moraes, Dror and Shaw (2011) Parallel random numbers: as easy
+ * as 1, 2, 3. Proc SC11. The generator has no state besides its key and
+ * counter: block i of random numbers is obtained by applying a keyed
+ * bijection to the 128-bit counter value i, which yields four 32-bit
+ * random integers. The generator produces the same numbers as the
+ * reference implementation Random123.
+ *
+ * The 64-bit seed is used as key. The upper half of the counter selects
+ * a stream, given by a virtual process and a purpose, e.g., connection
+ * building or a particular model, and the lower half enumerates the
+ * blocks of the stream. Streams with different (seed, vp, purpose) are
+ * therefore independent without any exchange of state, and any position
+ * in a stream can be reached in constant time.
+ *
+ * Since blocks are independent of each other, fill_uniform() computes
+ * many blocks in a single loop without dependencies between iterations,
+ * which the compiler can vectorize. fill_uniform() produces the same
+ * numbers as the corresponding number of calls to drand().
+ */
+class Philox : public RandomGen
+{
+public:
+  //! Create generator with given seed, using stream 0 of purpose 0
+  explicit Philox( unsigned long );
+
+  ~Philox(){};
+
+  RngPtr
+  clone( unsigned long s )
+  {
+    return RngPtr( new Philox( s ) );
+  }
+
+  /**
+   * Select the stream for the given virtual process and purpose.
+   * The generator is reset to the beginning of the stream.
+   */
+  void set_stream( const unsigned long vp, const unsigned long purpose );
+
+  //! Fill x with n numbers from [0, 1)
+  void fill_uniform( double* x, const size_t n );
+
+  //! Fill x with n standard normal numbers (Box-Muller method)
+  void fill_normal( double* x, const size_t n );
+
+  //! Fill k with n numbers from the Poisson distribution with given mean
+  void fill_poisson( long* k, const size_t n, const double lambda );
+
+private:
+  //! implements seeding for RandomGen
+  void seed_( unsigned long );
+
+  //! implements drawing a single [0,1) number for RandomGen
+  double drand_();
+
+  /**
+   * Compute num_blocks blocks of the current stream, starting at block
+   * first_block, and write 4 * num_blocks numbers to out.
+   */
+  void generate_( const uint64_t first_block,
+    const size_t num_blocks,
+    uint32_t* out ) const;
+
+  //! draw Poisson number with PTRS method for large lambda
+  long poisson_ptrs_( const double lambda );
+
+  //! check implementation against reference values
+  void self_test_();
+
+  static const uint32_t M0_;      //!< multiplier of first half of counter
+  static const uint32_t M1_;      //!< multiplier of second half of counter
+  static const uint32_t W0_;      //!< key increment, golden ratio
+  static const uint32_t W1_;      //!< key increment, sqrt(3) - 1
+  static const double I2DFactor_; //!< int to double factor
+
+  uint32_t key_[ 2 ];    //!< key, given by seed
+  uint32_t stream_[ 2 ]; //!< upper half of counter, vp and purpose
+  uint64_t next_block_;  //!< lower half of counter for next block
+
+  uint32_t buffer_[ 4 ];    //!< block used by drand_()
+  unsigned int buffer_pos_; //!< next number in buffer_, 4 if used up
+};
+
+inline double
+Philox::drand_()
+{
+  if ( buffer_pos_ == 4 )
+  {
+    generate_( next_block_++, 1, buffer_ );
+    buffer_pos_ = 0;
+  }
+  return I2DFactor_ * buffer_[ buffer_pos_++ ];
+}
+}
+
+#endif
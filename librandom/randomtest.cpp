@@ -39,6 +39,7 @@
 #include "knuthlfg.h"
 #include "mt19937.h"
 #include "normal_randomdev.h"
+#include "philox.h"
 #include "poisson_randomdev.h"
 #include "random_datums.h"
 #include "randomdev.h"
@@ -143,6 +144,7 @@ main( void )
   // add non-GSL rngs
   register_rng< librandom::KnuthLFG >( "KnuthLFG", rngdictd );
   register_rng< librandom::MT19937 >( "MT19937", rngdictd );
+  register_rng< librandom::Philox >( "Philox", rngdictd );
 
   // let GslRandomGen add all of the GSL rngs
   librandom::GslRandomGen::add_gsl_rngs( rngdict );
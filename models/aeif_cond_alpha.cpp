@@ -22,8 +22,6 @@
 
 #include "aeif_cond_alpha.h"
 
-#ifdef HAVE_GSL
-
 // C++ includes:
 #include <cmath>
 #include <cstdio>
@@ -35,6 +33,7 @@
 #include "numerics.h"
 
 // Includes from nestkernel:
+#include "batch_update.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "nest_names.h"
@@ -73,24 +72,18 @@ RecordablesMap< aeif_cond_alpha >::create()
 }
 }
 
-extern "C" int
-nest::aeif_cond_alpha_dynamics( double,
+inline void
+nest::aeif_cond_alpha::Dynamics_::operator()( double,
   const double y[],
-  double f[],
-  void* pnode )
+  double f[] ) const
 {
   // a shorthand
   typedef nest::aeif_cond_alpha::State_ S;
 
-  // get access to node so we can almost work as in a member function
-  assert( pnode );
-  const nest::aeif_cond_alpha& node =
-    *( reinterpret_cast< nest::aeif_cond_alpha* >( pnode ) );
-
-  const bool is_refractory = node.S_.r_ > 0;
+  const bool is_refractory = node_.S_.r_ > 0;
 
   // y[] here is---and must be---the state vector supplied by the integrator,
-  // not the state vector in the node, node.S_.y[].
+  // not the state vector in the node, node_.S_.y[].
 
   // The following code is verbose for the sake of clarity. We assume that a
   // good compiler will optimize the verbosity away ...
@@ -98,8 +91,9 @@ nest::aeif_cond_alpha_dynamics( double,
   // Clamp membrane potential to V_reset while refractory, otherwise bound
   // it to V_peak. Do not use V_.V_peak_ here, since that is set to V_th if
   // Delta_T == 0.
-  const double& V =
-    is_refractory ? node.P_.V_reset_ : std::min( y[ S::V_M ], node.P_.V_peak_ );
+  const double& V = is_refractory
+    ? node_.P_.V_reset_
+    : std::min( y[ S::V_M ], node_.P_.V_peak_ );
   // shorthand for the other state variables
   const double& dg_ex = y[ S::DG_EXC ];
   const double& g_ex = y[ S::G_EXC ];
@@ -107,32 +101,74 @@ nest::aeif_cond_alpha_dynamics( double,
   const double& g_in = y[ S::G_INH ];
   const double& w = y[ S::W ];
 
-  const double I_syn_exc = g_ex * ( V - node.P_.E_ex );
-  const double I_syn_inh = g_in * ( V - node.P_.E_in );
+  const double I_syn_exc = g_ex * ( V - node_.P_.E_ex );
+  const double I_syn_inh = g_in * ( V - node_.P_.E_in );
 
-  const double I_spike = node.P_.Delta_T == 0.
+  const double I_spike = node_.P_.Delta_T == 0.
     ? 0.
-    : ( node.P_.g_L * node.P_.Delta_T
-        * std::exp( ( V - node.P_.V_th ) / node.P_.Delta_T ) );
+    : ( node_.P_.g_L * node_.P_.Delta_T
+        * std::exp( ( V - node_.P_.V_th ) / node_.P_.Delta_T ) );
 
   // dv/dt
   f[ S::V_M ] = is_refractory
     ? 0.
-    : ( -node.P_.g_L * ( V - node.P_.E_L ) + I_spike - I_syn_exc - I_syn_inh - w
-        + node.P_.I_e + node.B_.I_stim_ ) / node.P_.C_m;
+    : ( -node_.P_.g_L * ( V - node_.P_.E_L ) + I_spike - I_syn_exc
+        - I_syn_inh - w + node_.P_.I_e + node_.B_.I_stim_ ) / node_.P_.C_m;
 
-  f[ S::DG_EXC ] = -dg_ex / node.P_.tau_syn_ex;
+  f[ S::DG_EXC ] = -dg_ex / node_.P_.tau_syn_ex;
   // Synaptic Conductance (nS)
-  f[ S::G_EXC ] = dg_ex - g_ex / node.P_.tau_syn_ex;
+  f[ S::G_EXC ] = dg_ex - g_ex / node_.P_.tau_syn_ex;
 
-  f[ S::DG_INH ] = -dg_in / node.P_.tau_syn_in;
+  f[ S::DG_INH ] = -dg_in / node_.P_.tau_syn_in;
   // Synaptic Conductance (nS)
-  f[ S::G_INH ] = dg_in - g_in / node.P_.tau_syn_in;
+  f[ S::G_INH ] = dg_in - g_in / node_.P_.tau_syn_in;
 
   // Adaptation current w.
-  f[ S::W ] = ( node.P_.a * ( V - node.P_.E_L ) - w ) / node.P_.tau_w;
+  f[ S::W ] = ( node_.P_.a * ( V - node_.P_.E_L ) - w ) / node_.P_.tau_w;
+}
+
+inline void
+nest::aeif_cond_alpha::BatchDynamics_::operator()( double,
+  const double y[],
+  double f[] ) const
+{
+  // a shorthand
+  typedef nest::aeif_cond_alpha::State_ S;
 
-  return GSL_SUCCESS;
+  // The arithmetic is identical to Dynamics_, written as a loop over the
+  // lanes without dependencies between iterations.
+  for ( size_t l = 0; l < L; ++l )
+  {
+    const double V = is_refractory[ l ]
+      ? V_reset_[ l ]
+      : std::min( y[ S::V_M * L + l ], V_peak_[ l ] );
+    const double dg_ex = y[ S::DG_EXC * L + l ];
+    const double g_ex = y[ S::G_EXC * L + l ];
+    const double dg_in = y[ S::DG_INH * L + l ];
+    const double g_in = y[ S::G_INH * L + l ];
+    const double w = y[ S::W * L + l ];
+
+    const double I_syn_exc = g_ex * ( V - E_ex[ l ] );
+    const double I_syn_inh = g_in * ( V - E_in[ l ] );
+
+    const double I_spike = Delta_T[ l ] == 0.
+      ? 0.
+      : ( g_L[ l ] * Delta_T[ l ]
+          * std::exp( ( V - V_th[ l ] ) / Delta_T[ l ] ) );
+
+    f[ S::V_M * L + l ] = is_refractory[ l ]
+      ? 0.
+      : ( -g_L[ l ] * ( V - E_L[ l ] ) + I_spike - I_syn_exc - I_syn_inh - w
+          + I_e[ l ] + I_stim[ l ] ) / C_m[ l ];
+
+    f[ S::DG_EXC * L + l ] = -dg_ex / tau_syn_ex[ l ];
+    f[ S::G_EXC * L + l ] = dg_ex - g_ex / tau_syn_ex[ l ];
+
+    f[ S::DG_INH * L + l ] = -dg_in / tau_syn_in[ l ];
+    f[ S::G_INH * L + l ] = dg_in - g_in / tau_syn_in[ l ];
+
+    f[ S::W * L + l ] = ( a[ l ] * ( V - E_L[ l ] ) - w ) / tau_w[ l ];
+  }
 }
 
 
@@ -324,9 +360,7 @@ nest::aeif_cond_alpha::State_::set( const DictionaryDatum& d,
 
 nest::aeif_cond_alpha::Buffers_::Buffers_( aeif_cond_alpha& n )
   : logger_( n )
-  , s_( 0 )
-  , c_( 0 )
-  , e_( 0 )
+  , solver_( ode::StepControl::yp( n.P_.gsl_error_tol, n.P_.gsl_error_tol ) )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
@@ -334,16 +368,14 @@ nest::aeif_cond_alpha::Buffers_::Buffers_( aeif_cond_alpha& n )
 
 nest::aeif_cond_alpha::Buffers_::Buffers_( const Buffers_&, aeif_cond_alpha& n )
   : logger_( n )
-  , s_( 0 )
-  , c_( 0 )
-  , e_( 0 )
+  , solver_( ode::StepControl::yp( n.P_.gsl_error_tol, n.P_.gsl_error_tol ) )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
 }
 
 /* ----------------------------------------------------------------
- * Default and copy constructor for node, and destructor
+ * Default and copy constructor for node
  * ---------------------------------------------------------------- */
 
 nest::aeif_cond_alpha::aeif_cond_alpha()
@@ -363,23 +395,6 @@ nest::aeif_cond_alpha::aeif_cond_alpha( const aeif_cond_alpha& n )
 {
 }
 
-nest::aeif_cond_alpha::~aeif_cond_alpha()
-{
-  // GSL structs may not have been allocated, so we need to protect destruction
-  if ( B_.s_ )
-  {
-    gsl_odeiv_step_free( B_.s_ );
-  }
-  if ( B_.c_ )
-  {
-    gsl_odeiv_control_free( B_.c_ );
-  }
-  if ( B_.e_ )
-  {
-    gsl_odeiv_evolve_free( B_.e_ );
-  }
-}
-
 /* ----------------------------------------------------------------
  * Node initialization functions
  * ---------------------------------------------------------------- */
@@ -406,39 +421,8 @@ nest::aeif_cond_alpha::init_buffers_()
   // We must integrate this model with high-precision to obtain decent results
   B_.IntegrationStep_ = std::min( 0.01, B_.step_ );
 
-  if ( B_.s_ == 0 )
-  {
-    B_.s_ =
-      gsl_odeiv_step_alloc( gsl_odeiv_step_rkf45, State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_step_reset( B_.s_ );
-  }
-
-  if ( B_.c_ == 0 )
-  {
-    B_.c_ = gsl_odeiv_control_yp_new( P_.gsl_error_tol, P_.gsl_error_tol );
-  }
-  else
-  {
-    gsl_odeiv_control_init(
-      B_.c_, P_.gsl_error_tol, P_.gsl_error_tol, 0.0, 1.0 );
-  }
-
-  if ( B_.e_ == 0 )
-  {
-    B_.e_ = gsl_odeiv_evolve_alloc( State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_evolve_reset( B_.e_ );
-  }
-
-  B_.sys_.jacobian = NULL;
-  B_.sys_.dimension = State_::STATE_VEC_SIZE;
-  B_.sys_.params = reinterpret_cast< void* >( this );
-  B_.sys_.function = aeif_cond_alpha_dynamics;
+  B_.solver_.set_control(
+    ode::StepControl::yp( P_.gsl_error_tol, P_.gsl_error_tol ) );
 
   B_.I_stim_ = 0.0;
 }
@@ -449,7 +433,7 @@ nest::aeif_cond_alpha::calibrate()
   // ensures initialization in case mm connected after Simulate
   B_.logger_.init();
 
-  // set the right threshold and GSL function depending on Delta_T
+  // set the right threshold depending on Delta_T
   if ( P_.Delta_T > 0. )
   {
     V_.V_peak = P_.V_peak_;
@@ -486,7 +470,7 @@ nest::aeif_cond_alpha::update( Time const& origin,
 
     // numerical integration with adaptive step size control:
     // ------------------------------------------------------
-    // gsl_odeiv_evolve_apply performs only a single numerical
+    // evolve() performs only a single numerical
     // integration step, starting from t and bounded by step;
     // the while-loop ensures integration over the whole simulation
     // step (0, step] if more than one integration step is needed due
@@ -499,18 +483,11 @@ nest::aeif_cond_alpha::update( Time const& origin,
 
     while ( t < B_.step_ )
     {
-      const int status = gsl_odeiv_evolve_apply( B_.e_,
-        B_.c_,
-        B_.s_,
-        &B_.sys_,             // system of ODE
-        &t,                   // from t
-        B_.step_,             // to t <= step
-        &B_.IntegrationStep_, // integration step size
-        S_.y_ );              // neuronal state
-      if ( status != GSL_SUCCESS )
-      {
-        throw GSLSolverFailure( get_name(), status );
-      }
+      B_.solver_.evolve( Dynamics_( *this ), // system of ODE
+        t,                                   // from t
+        B_.step_,                            // to t <= step
+        B_.IntegrationStep_,                 // integration step size
+        S_.y_ );                             // neuronal state
 
       // check for unreasonable values; we allow V_M to explode
       if ( S_.y_[ State_::V_M ] < -1e3 || S_.y_[ State_::W ] < -1e6
@@ -562,6 +539,172 @@ nest::aeif_cond_alpha::update( Time const& origin,
   }
 }
 
+void
+nest::aeif_cond_alpha::update_batch(
+  std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  assert(
+    to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  typedef State_ S;
+  const size_t L = ode::batch_lanes;
+  const size_t N = S::STATE_VEC_SIZE;
+
+  BatchUpdate< aeif_cond_alpha > batch( first, last );
+  const size_t n = batch.size();
+
+  for ( size_t first_lane = 0; first_lane < n; first_lane += L )
+  {
+    // Lanes beyond the end of the batch repeat the last node. They are
+    // integrated like the other lanes, so that they do not affect the
+    // step size, but their results are discarded.
+    const size_t num_lanes = std::min( L, n - first_lane );
+    aeif_cond_alpha* nodes[ L ];
+    for ( size_t l = 0; l < L; ++l )
+    {
+      nodes[ l ] =
+        &batch.get_node( first_lane + std::min( l, num_lanes - 1 ) );
+    }
+
+    BatchDynamics_ dyn;
+    double y[ N * L ];
+    unsigned int r[ L ];
+    double V_peak[ L ];
+    double b[ L ];
+    double g0_ex[ L ];
+    double g0_in[ L ];
+    unsigned int refractory_counts[ L ];
+
+    // the lanes share the smallest step size and error bound of the group
+    double h = nodes[ 0 ]->B_.IntegrationStep_;
+    double error_tol = nodes[ 0 ]->P_.gsl_error_tol;
+    for ( size_t l = 0; l < L; ++l )
+    {
+      const aeif_cond_alpha& node = *nodes[ l ];
+      for ( size_t i = 0; i < N; ++i )
+      {
+        y[ i * L + l ] = node.S_.y_[ i ];
+      }
+      r[ l ] = node.S_.r_;
+      V_peak[ l ] = node.V_.V_peak;
+      b[ l ] = node.P_.b;
+      g0_ex[ l ] = node.V_.g0_ex_;
+      g0_in[ l ] = node.V_.g0_in_;
+      refractory_counts[ l ] = node.V_.refractory_counts_;
+
+      dyn.is_refractory[ l ] = r[ l ] > 0;
+      dyn.V_peak_[ l ] = node.P_.V_peak_;
+      dyn.V_reset_[ l ] = node.P_.V_reset_;
+      dyn.g_L[ l ] = node.P_.g_L;
+      dyn.C_m[ l ] = node.P_.C_m;
+      dyn.E_ex[ l ] = node.P_.E_ex;
+      dyn.E_in[ l ] = node.P_.E_in;
+      dyn.E_L[ l ] = node.P_.E_L;
+      dyn.Delta_T[ l ] = node.P_.Delta_T;
+      dyn.tau_w[ l ] = node.P_.tau_w;
+      dyn.a[ l ] = node.P_.a;
+      dyn.V_th[ l ] = node.P_.V_th;
+      dyn.tau_syn_ex[ l ] = node.P_.tau_syn_ex;
+      dyn.tau_syn_in[ l ] = node.P_.tau_syn_in;
+      dyn.I_e[ l ] = node.P_.I_e;
+      dyn.I_stim[ l ] = node.B_.I_stim_;
+
+      h = std::min( h, node.B_.IntegrationStep_ );
+      error_tol = std::min( error_tol, node.P_.gsl_error_tol );
+    }
+
+    const ode::RKF45< N * L > solver(
+      ode::StepControl::yp( error_tol, error_tol ) );
+
+    for ( long lag = from; lag < to; ++lag )
+    {
+      double t = 0.0;
+
+      // see update() for the integration over the simulation step
+      while ( t < B_.step_ )
+      {
+        solver.evolve( dyn, t, B_.step_, h, y );
+
+        for ( size_t l = 0; l < L; ++l )
+        {
+          double& V_m = y[ S::V_M * L + l ];
+          double& w = y[ S::W * L + l ];
+
+          if ( V_m < -1e3 || w < -1e6 || w > 1e6 )
+          {
+            throw NumericalInstability( get_name() );
+          }
+
+          if ( r[ l ] > 0 )
+          {
+            V_m = dyn.V_reset_[ l ];
+          }
+          else if ( V_m >= V_peak[ l ] )
+          {
+            V_m = dyn.V_reset_[ l ];
+            w += b[ l ]; // spike-driven adaptation
+            r[ l ] = refractory_counts[ l ] > 0 ? refractory_counts[ l ] + 1 : 0;
+            dyn.is_refractory[ l ] = r[ l ] > 0;
+
+            if ( l < num_lanes )
+            {
+              batch.add_spike( first_lane + l, lag );
+            }
+          }
+        }
+      }
+
+      for ( size_t l = 0; l < L; ++l )
+      {
+        // decrement refractory count
+        if ( r[ l ] > 0 )
+        {
+          --r[ l ];
+        }
+        dyn.is_refractory[ l ] = r[ l ] > 0;
+
+        // apply spikes and set new input current; repeated lanes copy the
+        // input of the last node, whose ring buffers are already cleared
+        if ( l < num_lanes )
+        {
+          aeif_cond_alpha& node = *nodes[ l ];
+          y[ S::DG_EXC * L + l ] +=
+            node.B_.spike_exc_.get_value( lag ) * g0_ex[ l ];
+          y[ S::DG_INH * L + l ] +=
+            node.B_.spike_inh_.get_value( lag ) * g0_in[ l ];
+          dyn.I_stim[ l ] = node.B_.currents_.get_value( lag );
+        }
+        else
+        {
+          const size_t k = num_lanes - 1;
+          y[ S::DG_EXC * L + l ] = y[ S::DG_EXC * L + k ];
+          y[ S::DG_INH * L + l ] = y[ S::DG_INH * L + k ];
+          dyn.I_stim[ l ] = dyn.I_stim[ k ];
+        }
+      }
+    }
+
+    for ( size_t l = 0; l < num_lanes; ++l )
+    {
+      aeif_cond_alpha& node = *nodes[ l ];
+      for ( size_t i = 0; i < N; ++i )
+      {
+        node.S_.y_[ i ] = y[ i * L + l ];
+      }
+      node.S_.r_ = r[ l ];
+      node.B_.I_stim_ = dyn.I_stim[ l ];
+      node.B_.IntegrationStep_ = h;
+    }
+  }
+
+  batch.finish( origin, from, to );
+}
+
 void
 nest::aeif_cond_alpha::handle( SpikeEvent& e )
 {
@@ -601,4 +744,3 @@ nest::aeif_cond_alpha::handle( DataLoggingRequest& e )
   B_.logger_.handle( e );
 }
 
-#endif // HAVE_GSL
@@ -23,15 +23,8 @@
 #ifndef AEIF_COND_ALPHA_H
 #define AEIF_COND_ALPHA_H
 
-// Generated includes:
-#include "config.h"
-
-#ifdef HAVE_GSL
-
-// External includes:
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_odeiv.h>
+// Includes from libnestutil:
+#include "ode_solver.h"
 
 // Includes from nestkernel:
 #include "archiving_node.h"
@@ -44,32 +37,6 @@
 
 namespace nest
 {
-/**
- * Function computing right-hand side of ODE for GSL solver if Delta_T != 0.
- * @note Must be declared here so we can befriend it in class.
- * @note Must have C-linkage for passing to GSL. Internally, it is
- *       a first-class C++ function, but cannot be a member function
- *       because of the C-linkage.
- * @note No point in declaring it inline, since it is called
- *       through a function pointer.
- * @param void* Pointer to model neuron instance.
- */
-extern "C" int
-aeif_cond_alpha_dynamics( double, const double*, double*, void* );
-
-/**
- * Function computing right-hand side of ODE for GSL solver if Delta_T == 0.
- * @note Must be declared here so we can befriend it in class.
- * @note Must have C-linkage for passing to GSL. Internally, it is
- *       a first-class C++ function, but cannot be a member function
- *       because of the C-linkage.
- * @note No point in declaring it inline, since it is called
- *       through a function pointer.
- * @param void* Pointer to model neuron instance.
- */
-extern "C" int
-aeif_cond_alpha_dynamics_DT0( double, const double*, double*, void* );
-
 /** @BeginDocumentation
 Name: aeif_cond_alpha -  Conductance based exponential integrate-and-fire neuron
                          model according to Brette and Gerstner (2005).
@@ -83,6 +50,12 @@ Synaptic conductances are modelled as alpha-functions.
 This implementation uses the embedded 4th order Runge-Kutta-Fehlberg solver with
 adaptive step size to integrate the differential equation.
 
+If the kernel property batch_update is set, neurons are integrated in groups
+of four or eight, depending on the vector instructions of the target, with a
+step size shared by the group. The step size is the smallest admissible one
+in the group, so the error bound gsl_error_tol holds for each neuron, but the
+results differ from those of the individual update within this bound.
+
 The membrane potential is given by the following differential equation:
 C dV/dt= -g_L(V-E_L)+g_L*Delta_T*exp((V-V_T)/Delta_T)-g_e(t)(V-E_e)
                                                      -g_i(t)(V-E_i)-w +I_e
@@ -129,7 +102,7 @@ Synaptic parameters
 
 Integration parameters
   gsl_error_tol  double - This parameter controls the admissible error of the
-                          GSL integrator. Reduce it if NEST complains about
+                          ODE integrator. Reduce it if NEST complains about
                           numerical instabilities.
 
 Author: Marc-Oliver Gewaltig; full revision by Tanguy Fardet on December 2016
@@ -150,7 +123,6 @@ class aeif_cond_alpha : public Archiving_Node
 public:
   aeif_cond_alpha();
   aeif_cond_alpha( const aeif_cond_alpha& );
-  ~aeif_cond_alpha();
 
   /**
    * Import sets of overloaded virtual functions.
@@ -179,16 +151,23 @@ private:
   void calibrate();
   void update( Time const&, const long, const long );
 
+  bool supports_batch_update() const;
+  void update_batch( std::vector< Node* >::const_iterator,
+    std::vector< Node* >::const_iterator,
+    Time const&,
+    const long,
+    const long );
+  bool is_batch_updatable_() const;
+
   // END Boilerplate function declarations ----------------------------
 
   // Friends --------------------------------------------------------
 
-  // make dynamics function quasi-member
-  friend int aeif_cond_alpha_dynamics( double, const double*, double*, void* );
-
-  // The next two classes need to be friends to access the State_ class/member
+  // The next three classes need to be friends to access the State_
+  // class/member
   friend class RecordablesMap< aeif_cond_alpha >;
   friend class UniversalDataLogger< aeif_cond_alpha >;
+  friend class BatchUpdate< aeif_cond_alpha >;
 
 private:
   // ----------------------------------------------------------------
@@ -215,7 +194,7 @@ private:
     double tau_syn_in; //!< Excitatory synaptic rise time.
     double I_e;        //!< Intrinsic current in pA.
 
-    double gsl_error_tol; //!< error bound for GSL integrator
+    double gsl_error_tol; //!< error bound for ODE integrator
 
     Parameters_(); //!< Sets default parameter values
 
@@ -235,7 +214,7 @@ public:
   {
     /**
      * Enumeration identifying elements in state array State_::y_.
-     * The state vector must be passed to GSL as a C array. This enum
+     * The state vector must be passed to the solver as a C array. This enum
      * identifies the elements of the vector. It must be public to be
      * accessible from the iteration function.
      */
@@ -251,7 +230,7 @@ public:
     };
 
     double y_[ STATE_VEC_SIZE ]; //!< neuron state, must be C-array for
-                                 //!< GSL solver
+                                 //!< ODE solver
     unsigned int r_;             //!< number of refractory steps remaining
 
     State_( const Parameters_& ); //!< Default initialization
@@ -269,8 +248,8 @@ public:
    */
   struct Buffers_
   {
-    Buffers_( aeif_cond_alpha& );                  //!<Sets buffer pointers to 0
-    Buffers_( const Buffers_&, aeif_cond_alpha& ); //!<Sets buffer pointers to 0
+    Buffers_( aeif_cond_alpha& );
+    Buffers_( const Buffers_&, aeif_cond_alpha& );
 
     //! Logger for all analog data
     UniversalDataLogger< aeif_cond_alpha > logger_;
@@ -280,18 +259,16 @@ public:
     RingBuffer spike_inh_;
     RingBuffer currents_;
 
-    /** GSL ODE stuff */
-    gsl_odeiv_step* s_;    //!< stepping function
-    gsl_odeiv_control* c_; //!< adaptive stepsize control function
-    gsl_odeiv_evolve* e_;  //!< evolution function
-    gsl_odeiv_system sys_; //!< struct describing the GSL system
+    //! adaptive ODE solver
+    ode::RKF45< State_::STATE_VEC_SIZE > solver_;
 
     // IntergrationStep_ should be reset with the neuron on ResetNetwork,
     // but remain unchanged during calibration. Since it is initialized with
     // step_, and the resolution cannot change after nodes have been created,
     // it is safe to place both here.
     double step_;            //!< step size in ms
-    double IntegrationStep_; //!< current integration time step, updated by GSL
+    double IntegrationStep_; //!< current integration time step, updated by
+                             //!< the solver
 
     /**
      * Input current injected by CurrentEvent.
@@ -325,6 +302,55 @@ public:
     unsigned int refractory_counts_;
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Right-hand side of the model equations, passed to the ODE solver.
+   */
+  struct Dynamics_
+  {
+    explicit Dynamics_( const aeif_cond_alpha& node )
+      : node_( node )
+    {
+    }
+
+    void operator()( double, const double y[], double f[] ) const;
+
+    const aeif_cond_alpha& node_;
+  };
+
+  /**
+   * Right-hand side of the model equations for ode::batch_lanes nodes
+   * integrated together by update_batch().
+   *
+   * Element i * batch_lanes + l of the state vector holds element i of
+   * State_::y_ of the node in lane l. Lanes not occupied by a node of the
+   * batch repeat the last node.
+   */
+  struct BatchDynamics_
+  {
+    static const size_t L = ode::batch_lanes;
+
+    void operator()( double, const double y[], double f[] ) const;
+
+    bool is_refractory[ L ];
+    double V_peak_[ L ];
+    double V_reset_[ L ];
+    double g_L[ L ];
+    double C_m[ L ];
+    double E_ex[ L ];
+    double E_in[ L ];
+    double E_L[ L ];
+    double Delta_T[ L ];
+    double tau_w[ L ];
+    double a[ L ];
+    double V_th[ L ];
+    double tau_syn_ex[ L ];
+    double tau_syn_in[ L ];
+    double I_e[ L ];
+    double I_stim[ L ];
+  };
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out state vector elements, used by UniversalDataLogger
@@ -389,6 +415,18 @@ aeif_cond_alpha::handles_test_event( DataLoggingRequest& dlr,
   return B_.logger_.connect_logging_device( dlr, recordablesMap_ );
 }
 
+inline bool
+aeif_cond_alpha::supports_batch_update() const
+{
+  return true;
+}
+
+inline bool
+aeif_cond_alpha::is_batch_updatable_() const
+{
+  return not B_.logger_.is_recording();
+}
+
 inline void
 aeif_cond_alpha::get_status( DictionaryDatum& d ) const
 {
@@ -420,5 +458,4 @@ aeif_cond_alpha::set_status( const DictionaryDatum& d )
 
 } // namespace
 
-#endif // HAVE_GSL
 #endif // AEIF_COND_ALPHA_H
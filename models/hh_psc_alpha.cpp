@@ -23,8 +23,6 @@
 
 #include "hh_psc_alpha.h"
 
-#ifdef HAVE_GSL
-
 // C++ includes:
 #include <cstdio>
 #include <iomanip>
@@ -71,20 +69,18 @@ RecordablesMap< hh_psc_alpha >::create()
   insert_(
     names::Inact_n, &hh_psc_alpha::get_y_elem_< hh_psc_alpha::State_::HH_N > );
 }
+}
 
-extern "C" int
-hh_psc_alpha_dynamics( double, const double y[], double f[], void* pnode )
+inline void
+nest::hh_psc_alpha::Dynamics_::operator()( double,
+  const double y[],
+  double f[] ) const
 {
   // a shorthand
   typedef nest::hh_psc_alpha::State_ S;
 
-  // get access to node so we can almost work as in a member function
-  assert( pnode );
-  const nest::hh_psc_alpha& node =
-    *( reinterpret_cast< nest::hh_psc_alpha* >( pnode ) );
-
   // y[] here is---and must be---the state vector supplied by the integrator,
-  // not the state vector in the node, node.S_.y[].
+  // not the state vector in the node, node_.S_.y[].
 
   // The following code is verbose for the sake of clarity. We assume that a
   // good compiler will optimize the verbosity away ...
@@ -108,13 +104,13 @@ hh_psc_alpha_dynamics( double, const double y[], double f[], void* pnode )
   const double alpha_h = 0.07 * std::exp( -( V + 65. ) / 20. );
   const double beta_h = 1. / ( 1. + std::exp( -( V + 35. ) / 10. ) );
 
-  const double I_Na = node.P_.g_Na * m * m * m * h * ( V - node.P_.E_Na );
-  const double I_K = node.P_.g_K * n * n * n * n * ( V - node.P_.E_K );
-  const double I_L = node.P_.g_L * ( V - node.P_.E_L );
+  const double I_Na = node_.P_.g_Na * m * m * m * h * ( V - node_.P_.E_Na );
+  const double I_K = node_.P_.g_K * n * n * n * n * ( V - node_.P_.E_K );
+  const double I_L = node_.P_.g_L * ( V - node_.P_.E_L );
 
   // V dot -- synaptic input are currents, inhib current is negative
-  f[ S::V_M ] = ( -( I_Na + I_K + I_L ) + node.B_.I_stim_ + node.P_.I_e + I_ex
-                  + I_in ) / node.P_.C_m;
+  f[ S::V_M ] = ( -( I_Na + I_K + I_L ) + node_.B_.I_stim_ + node_.P_.I_e + I_ex
+                  + I_in ) / node_.P_.C_m;
 
   // channel dynamics
   f[ S::HH_M ] =
@@ -125,13 +121,10 @@ hh_psc_alpha_dynamics( double, const double y[], double f[], void* pnode )
     alpha_n * ( 1 - y[ S::HH_N ] ) - beta_n * y[ S::HH_N ]; // n-variable
 
   // synapses: alpha functions
-  f[ S::DI_EXC ] = -dI_ex / node.P_.tau_synE;
-  f[ S::I_EXC ] = dI_ex - ( I_ex / node.P_.tau_synE );
-  f[ S::DI_INH ] = -dI_in / node.P_.tau_synI;
-  f[ S::I_INH ] = dI_in - ( I_in / node.P_.tau_synI );
-
-  return GSL_SUCCESS;
-}
+  f[ S::DI_EXC ] = -dI_ex / node_.P_.tau_synE;
+  f[ S::I_EXC ] = dI_ex - ( I_ex / node_.P_.tau_synE );
+  f[ S::DI_INH ] = -dI_in / node_.P_.tau_synI;
+  f[ S::I_INH ] = dI_in - ( I_in / node_.P_.tau_synI );
 }
 
 /* ----------------------------------------------------------------
@@ -276,9 +269,7 @@ nest::hh_psc_alpha::State_::set( const DictionaryDatum& d )
 
 nest::hh_psc_alpha::Buffers_::Buffers_( hh_psc_alpha& n )
   : logger_( n )
-  , s_( 0 )
-  , c_( 0 )
-  , e_( 0 )
+  , solver_( ode::StepControl::y( 1e-3, 0.0 ) )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
@@ -286,16 +277,14 @@ nest::hh_psc_alpha::Buffers_::Buffers_( hh_psc_alpha& n )
 
 nest::hh_psc_alpha::Buffers_::Buffers_( const Buffers_&, hh_psc_alpha& n )
   : logger_( n )
-  , s_( 0 )
-  , c_( 0 )
-  , e_( 0 )
+  , solver_( ode::StepControl::y( 1e-3, 0.0 ) )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
 }
 
 /* ----------------------------------------------------------------
- * Default and copy constructor for node, and destructor
+ * Default and copy constructor for node
  * ---------------------------------------------------------------- */
 
 nest::hh_psc_alpha::hh_psc_alpha()
@@ -315,23 +304,6 @@ nest::hh_psc_alpha::hh_psc_alpha( const hh_psc_alpha& n )
 {
 }
 
-nest::hh_psc_alpha::~hh_psc_alpha()
-{
-  // GSL structs may not have been allocated, so we need to protect destruction
-  if ( B_.s_ )
-  {
-    gsl_odeiv_step_free( B_.s_ );
-  }
-  if ( B_.c_ )
-  {
-    gsl_odeiv_control_free( B_.c_ );
-  }
-  if ( B_.e_ )
-  {
-    gsl_odeiv_evolve_free( B_.e_ );
-  }
-}
-
 /* ----------------------------------------------------------------
  * Node initialization functions
  * ---------------------------------------------------------------- */
@@ -356,39 +328,6 @@ nest::hh_psc_alpha::init_buffers_()
   B_.step_ = Time::get_resolution().get_ms();
   B_.IntegrationStep_ = B_.step_;
 
-  if ( B_.s_ == 0 )
-  {
-    B_.s_ =
-      gsl_odeiv_step_alloc( gsl_odeiv_step_rkf45, State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_step_reset( B_.s_ );
-  }
-
-  if ( B_.c_ == 0 )
-  {
-    B_.c_ = gsl_odeiv_control_y_new( 1e-3, 0.0 );
-  }
-  else
-  {
-    gsl_odeiv_control_init( B_.c_, 1e-3, 0.0, 1.0, 0.0 );
-  }
-
-  if ( B_.e_ == 0 )
-  {
-    B_.e_ = gsl_odeiv_evolve_alloc( State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_evolve_reset( B_.e_ );
-  }
-
-  B_.sys_.function = hh_psc_alpha_dynamics;
-  B_.sys_.jacobian = NULL;
-  B_.sys_.dimension = State_::STATE_VEC_SIZE;
-  B_.sys_.params = reinterpret_cast< void* >( this );
-
   B_.I_stim_ = 0.0;
 }
 
@@ -425,7 +364,7 @@ nest::hh_psc_alpha::update( Time const& origin, const long from, const long to )
 
     // numerical integration with adaptive step size control:
     // ------------------------------------------------------
-    // gsl_odeiv_evolve_apply performs only a single numerical
+    // evolve() performs only a single numerical
     // integration step, starting from t and bounded by step;
     // the while-loop ensures integration over the whole simulation
     // step (0, step] if more than one integration step is needed due
@@ -437,18 +376,11 @@ nest::hh_psc_alpha::update( Time const& origin, const long from, const long to )
     // simulation intervals
     while ( t < B_.step_ )
     {
-      const int status = gsl_odeiv_evolve_apply( B_.e_,
-        B_.c_,
-        B_.s_,
-        &B_.sys_,             // system of ODE
-        &t,                   // from t
-        B_.step_,             // to t <= step
-        &B_.IntegrationStep_, // integration step size
-        S_.y_ );              // neuronal state
-      if ( status != GSL_SUCCESS )
-      {
-        throw GSLSolverFailure( get_name(), status );
-      }
+      B_.solver_.evolve( Dynamics_( *this ), // system of ODE
+        t,                                   // from t
+        B_.step_,                            // to t <= step
+        B_.IntegrationStep_,                 // integration step size
+        S_.y_ );                             // neuronal state
     }
 
     S_.y_[ State_::DI_EXC ] +=
@@ -521,4 +453,3 @@ nest::hh_psc_alpha::handle( DataLoggingRequest& e )
   B_.logger_.handle( e );
 }
 
-#endif // HAVE_GSL
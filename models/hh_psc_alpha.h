@@ -23,16 +23,8 @@
 #ifndef HH_PSC_ALPHA_H
 #define HH_PSC_ALPHA_H
 
-// Generated includes:
-#include "config.h"
-
-#ifdef HAVE_GSL
-
-// External includes:
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_odeiv.h>
-#include <gsl/gsl_sf_exp.h>
+// Includes from libnestutil:
+#include "ode_solver.h"
 
 // Includes from nestkernel:
 #include "archiving_node.h"
@@ -45,18 +37,6 @@
 
 namespace nest
 {
-/**
- * Function computing right-hand side of ODE for GSL solver.
- * @note Must be declared here so we can befriend it in class.
- * @note Must have C-linkage for passing to GSL. Internally, it is
- *       a first-class C++ function, but cannot be a member function
- *       because of the C-linkage.
- * @note No point in declaring it inline, since it is called
- *       through a function pointer.
- * @param void* Pointer to model neuron instance.
- */
-extern "C" int hh_psc_alpha_dynamics( double, const double*, double*, void* );
-
 /** @BeginDocumentation
 Name: hh_psc_alpha - Hodgkin-Huxley neuron model.
 
@@ -129,7 +109,6 @@ class hh_psc_alpha : public Archiving_Node
 public:
   hh_psc_alpha();
   hh_psc_alpha( const hh_psc_alpha& );
-  ~hh_psc_alpha();
 
   /**
    * Import sets of overloaded virtual functions.
@@ -182,9 +161,6 @@ private:
 
   // Friends --------------------------------------------------------
 
-  // make dynamics function quasi-member
-  friend int hh_psc_alpha_dynamics( double, const double*, double*, void* );
-
   // The next two classes need to be friend to access the State_ class/member
   friend class RecordablesMap< hh_psc_alpha >;
   friend class UniversalDataLogger< hh_psc_alpha >;
@@ -226,7 +202,7 @@ public:
 
     /**
      * Enumeration identifying elements in state array State_::y_.
-     * The state vector must be passed to GSL as a C array. This enum
+     * The state vector must be passed to the solver as a C array. This enum
      * identifies the elements of the vector. It must be public to be
      * accessible from the iteration function.
      */
@@ -244,7 +220,7 @@ public:
     };
 
 
-    //! neuron state, must be C-array for GSL solver
+    //! neuron state, must be C-array for ODE solver
     double y_[ STATE_VEC_SIZE ];
     int r_; //!< number of refractory steps remaining
 
@@ -264,8 +240,8 @@ private:
    */
   struct Buffers_
   {
-    Buffers_( hh_psc_alpha& );                  //!<Sets buffer pointers to 0
-    Buffers_( const Buffers_&, hh_psc_alpha& ); //!<Sets buffer pointers to 0
+    Buffers_( hh_psc_alpha& );
+    Buffers_( const Buffers_&, hh_psc_alpha& );
 
     //! Logger for all analog data
     UniversalDataLogger< hh_psc_alpha > logger_;
@@ -275,18 +251,16 @@ private:
     RingBuffer spike_inh_;
     RingBuffer currents_;
 
-    /** GSL ODE stuff */
-    gsl_odeiv_step* s_;    //!< stepping function
-    gsl_odeiv_control* c_; //!< adaptive stepsize control function
-    gsl_odeiv_evolve* e_;  //!< evolution function
-    gsl_odeiv_system sys_; //!< struct describing system
+    //! adaptive ODE solver
+    ode::RKF45< State_::STATE_VEC_SIZE > solver_;
 
     // IntergrationStep_ should be reset with the neuron on ResetNetwork,
     // but remain unchanged during calibration. Since it is initialized with
     // step_, and the resolution cannot change after nodes have been created,
     // it is safe to place both here.
     double step_;            //!< step size in ms
-    double IntegrationStep_; //!< current integration time step, updated by GSL
+    double IntegrationStep_; //!< current integration time step, updated by
+                             //!< the solver
 
     /**
      * Input current injected by CurrentEvent.
@@ -314,6 +288,23 @@ private:
     int RefractoryCounts_;
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Right-hand side of the model equations, passed to the ODE solver.
+   */
+  struct Dynamics_
+  {
+    explicit Dynamics_( const hh_psc_alpha& node )
+      : node_( node )
+    {
+    }
+
+    void operator()( double, const double y[], double f[] ) const;
+
+    const hh_psc_alpha& node_;
+  };
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out state vector elements, used by UniversalDataLogger
@@ -410,5 +401,4 @@ hh_psc_alpha::set_status( const DictionaryDatum& d )
 
 } // namespace
 
-#endif // HAVE_GSL
 #endif // HH_PSC_ALPHA_H
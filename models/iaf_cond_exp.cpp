@@ -22,8 +22,6 @@
 
 #include "iaf_cond_exp.h"
 
-#ifdef HAVE_GSL
-
 // C++ includes:
 #include <cstdio>
 #include <iomanip>
@@ -69,34 +67,29 @@ RecordablesMap< iaf_cond_exp >::create()
 }
 }
 
-extern "C" inline int
-nest::iaf_cond_exp_dynamics( double, const double y[], double f[], void* pnode )
+inline void
+nest::iaf_cond_exp::Dynamics_::operator()( double,
+  const double y[],
+  double f[] ) const
 {
   // a shorthand
   typedef nest::iaf_cond_exp::State_ S;
 
-  // get access to node so we can almost work as in a member function
-  assert( pnode );
-  const nest::iaf_cond_exp& node =
-    *( reinterpret_cast< nest::iaf_cond_exp* >( pnode ) );
-
   // y[] here is---and must be---the state vector supplied by the integrator,
-  // not the state vector in the node, node.S_.y[].
+  // not the state vector in the node, node_.S_.y[].
 
   // The following code is verbose for the sake of clarity. We assume that a
   // good compiler will optimize the verbosity away ...
-  const double I_syn_exc = y[ S::G_EXC ] * ( y[ S::V_M ] - node.P_.E_ex );
-  const double I_syn_inh = y[ S::G_INH ] * ( y[ S::V_M ] - node.P_.E_in );
-  const double I_L = node.P_.g_L * ( y[ S::V_M ] - node.P_.E_L );
+  const double I_syn_exc = y[ S::G_EXC ] * ( y[ S::V_M ] - node_.P_.E_ex );
+  const double I_syn_inh = y[ S::G_INH ] * ( y[ S::V_M ] - node_.P_.E_in );
+  const double I_L = node_.P_.g_L * ( y[ S::V_M ] - node_.P_.E_L );
 
   // V dot
-  f[ 0 ] = ( -I_L + node.B_.I_stim_ + node.P_.I_e - I_syn_exc - I_syn_inh )
-    / node.P_.C_m;
+  f[ 0 ] = ( -I_L + node_.B_.I_stim_ + node_.P_.I_e - I_syn_exc - I_syn_inh )
+    / node_.P_.C_m;
 
-  f[ 1 ] = -y[ S::G_EXC ] / node.P_.tau_synE;
-  f[ 2 ] = -y[ S::G_INH ] / node.P_.tau_synI;
-
-  return GSL_SUCCESS;
+  f[ 1 ] = -y[ S::G_EXC ] / node_.P_.tau_synE;
+  f[ 2 ] = -y[ S::G_INH ] / node_.P_.tau_synI;
 }
 
 /* ----------------------------------------------------------------
@@ -217,9 +210,7 @@ nest::iaf_cond_exp::State_::set( const DictionaryDatum& d, const Parameters_& )
 
 nest::iaf_cond_exp::Buffers_::Buffers_( iaf_cond_exp& n )
   : logger_( n )
-  , s_( 0 )
-  , c_( 0 )
-  , e_( 0 )
+  , solver_( ode::StepControl::y( 1e-3, 0.0 ) )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
@@ -227,16 +218,14 @@ nest::iaf_cond_exp::Buffers_::Buffers_( iaf_cond_exp& n )
 
 nest::iaf_cond_exp::Buffers_::Buffers_( const Buffers_&, iaf_cond_exp& n )
   : logger_( n )
-  , s_( 0 )
-  , c_( 0 )
-  , e_( 0 )
+  , solver_( ode::StepControl::y( 1e-3, 0.0 ) )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
 }
 
 /* ----------------------------------------------------------------
- * Default and copy constructor for node, and destructor
+ * Default and copy constructor for node
  * ---------------------------------------------------------------- */
 
 nest::iaf_cond_exp::iaf_cond_exp()
@@ -256,23 +245,6 @@ nest::iaf_cond_exp::iaf_cond_exp( const iaf_cond_exp& n )
 {
 }
 
-nest::iaf_cond_exp::~iaf_cond_exp()
-{
-  // GSL structs may not have been allocated, so we need to protect destruction
-  if ( B_.s_ )
-  {
-    gsl_odeiv_step_free( B_.s_ );
-  }
-  if ( B_.c_ )
-  {
-    gsl_odeiv_control_free( B_.c_ );
-  }
-  if ( B_.e_ )
-  {
-    gsl_odeiv_evolve_free( B_.e_ );
-  }
-}
-
 /* ----------------------------------------------------------------
  * Node initialization functions
  * ---------------------------------------------------------------- */
@@ -297,39 +269,6 @@ nest::iaf_cond_exp::init_buffers_()
   B_.step_ = Time::get_resolution().get_ms();
   B_.IntegrationStep_ = B_.step_;
 
-  if ( B_.s_ == 0 )
-  {
-    B_.s_ =
-      gsl_odeiv_step_alloc( gsl_odeiv_step_rkf45, State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_step_reset( B_.s_ );
-  }
-
-  if ( B_.c_ == 0 )
-  {
-    B_.c_ = gsl_odeiv_control_y_new( 1e-3, 0.0 );
-  }
-  else
-  {
-    gsl_odeiv_control_init( B_.c_, 1e-3, 0.0, 1.0, 0.0 );
-  }
-
-  if ( B_.e_ == 0 )
-  {
-    B_.e_ = gsl_odeiv_evolve_alloc( State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_evolve_reset( B_.e_ );
-  }
-
-  B_.sys_.function = iaf_cond_exp_dynamics;
-  B_.sys_.jacobian = NULL;
-  B_.sys_.dimension = State_::STATE_VEC_SIZE;
-  B_.sys_.params = reinterpret_cast< void* >( this );
-
   B_.I_stim_ = 0.0;
 }
 
@@ -363,7 +302,7 @@ nest::iaf_cond_exp::update( Time const& origin, const long from, const long to )
 
     // numerical integration with adaptive step size control:
     // ------------------------------------------------------
-    // gsl_odeiv_evolve_apply performs only a single numerical
+    // evolve() performs only a single numerical
     // integration step, starting from t and bounded by step;
     // the while-loop ensures integration over the whole simulation
     // step (0, step] if more than one integration step is needed due
@@ -375,18 +314,11 @@ nest::iaf_cond_exp::update( Time const& origin, const long from, const long to )
     // simulation intervals
     while ( t < B_.step_ )
     {
-      const int status = gsl_odeiv_evolve_apply( B_.e_,
-        B_.c_,
-        B_.s_,
-        &B_.sys_,             // system of ODE
-        &t,                   // from t
-        B_.step_,             // to t <= step
-        &B_.IntegrationStep_, // integration step size
-        S_.y_ );              // neuronal state
-      if ( status != GSL_SUCCESS )
-      {
-        throw GSLSolverFailure( get_name(), status );
-      }
+      B_.solver_.evolve( Dynamics_( *this ), // system of ODE
+        t,                                   // from t
+        B_.step_,                            // to t <= step
+        B_.IntegrationStep_,                 // integration step size
+        S_.y_ );                             // neuronal state
     }
 
     S_.y_[ State_::G_EXC ] += B_.spike_exc_.get_value( lag );
@@ -458,4 +390,3 @@ nest::iaf_cond_exp::handle( DataLoggingRequest& e )
   B_.logger_.handle( e );
 }
 
-#endif // HAVE_GSL
@@ -23,15 +23,8 @@
 #ifndef IAF_COND_EXP_H
 #define IAF_COND_EXP_H
 
-// Generated includes:
-#include "config.h"
-
-#ifdef HAVE_GSL
-
-// External includes:
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_odeiv.h>
+// Includes from libnestutil:
+#include "ode_solver.h"
 
 // Includes from nestkernel:
 #include "archiving_node.h"
@@ -44,18 +37,6 @@
 
 namespace nest
 {
-/**
- * Function computing right-hand side of ODE for GSL solver.
- * @note Must be declared here so we can befriend it in class.
- * @note Must have C-linkage for passing to GSL. Internally, it is
- *       a first-class C++ function, but cannot be a member function
- *       because of the C-linkage.
- * @note No point in declaring it inline, since it is called
- *       through a function pointer.
- * @param void* Pointer to model neuron instance.
- */
-extern "C" int iaf_cond_exp_dynamics( double, const double*, double*, void* );
-
 /** @BeginDocumentation
 Name: iaf_cond_exp - Simple conductance based leaky integrate-and-fire neuron
                      model.
@@ -107,7 +88,6 @@ class iaf_cond_exp : public Archiving_Node
 public:
   iaf_cond_exp();
   iaf_cond_exp( const iaf_cond_exp& );
-  ~iaf_cond_exp();
 
   /**
    * Import sets of overloaded virtual functions.
@@ -140,9 +120,6 @@ private:
 
   // Friends --------------------------------------------------------
 
-  // make dynamics function quasi-member
-  friend int iaf_cond_exp_dynamics( double, const double*, double*, void* );
-
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_cond_exp >;
   friend class UniversalDataLogger< iaf_cond_exp >;
@@ -191,7 +168,7 @@ public:
       STATE_VEC_SIZE
     };
 
-    //! neuron state, must be C-array for GSL solver
+    //! neuron state, must be C-array for ODE solver
     double y_[ STATE_VEC_SIZE ];
     int r_; //!< number of refractory steps remaining
 
@@ -211,8 +188,8 @@ private:
    */
   struct Buffers_
   {
-    Buffers_( iaf_cond_exp& );                  //!<Sets buffer pointers to 0
-    Buffers_( const Buffers_&, iaf_cond_exp& ); //!<Sets buffer pointers to 0
+    Buffers_( iaf_cond_exp& );
+    Buffers_( const Buffers_&, iaf_cond_exp& );
 
     //! Logger for all analog data
     UniversalDataLogger< iaf_cond_exp > logger_;
@@ -222,18 +199,16 @@ private:
     RingBuffer spike_inh_;
     RingBuffer currents_;
 
-    /** GSL ODE stuff */
-    gsl_odeiv_step* s_;    //!< stepping function
-    gsl_odeiv_control* c_; //!< adaptive stepsize control function
-    gsl_odeiv_evolve* e_;  //!< evolution function
-    gsl_odeiv_system sys_; //!< struct describing system
+    //! adaptive ODE solver
+    ode::RKF45< State_::STATE_VEC_SIZE > solver_;
 
     // IntergrationStep_ should be reset with the neuron on ResetNetwork,
     // but remain unchanged during calibration. Since it is initialized with
     // step_, and the resolution cannot change after nodes have been created,
     // it is safe to place both here.
     double step_;            //!< step size in ms
-    double IntegrationStep_; //!< current integration time step, updated by GSL
+    double IntegrationStep_; //!< current integration time step, updated by
+                             //!< the solver
 
     /**
      * Input current injected by CurrentEvent.
@@ -255,6 +230,23 @@ private:
     int RefractoryCounts_;
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Right-hand side of the model equations, passed to the ODE solver.
+   */
+  struct Dynamics_
+  {
+    explicit Dynamics_( const iaf_cond_exp& node )
+      : node_( node )
+    {
+    }
+
+    void operator()( double, const double y[], double f[] ) const;
+
+    const iaf_cond_exp& node_;
+  };
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out state vector elements, used by UniversalDataLogger
@@ -350,5 +342,4 @@ iaf_cond_exp::set_status( const DictionaryDatum& d )
 
 } // namespace
 
-#endif // HAVE_GSL
 #endif // IAF_COND_EXP_H
@@ -23,6 +23,7 @@
 #include "iaf_psc_alpha.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -30,6 +31,7 @@
 #include "propagator_stability.h"
 
 // Includes from nestkernel:
+#include "batch_update.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "universal_data_logger_impl.h"
@@ -43,6 +45,9 @@
 nest::RecordablesMap< nest::iaf_psc_alpha >
   nest::iaf_psc_alpha::recordablesMap_;
 
+nest::PropagatorCache< nest::iaf_psc_alpha::Propagators_ >
+  nest::iaf_psc_alpha::propagatorCache_;
+
 namespace nest
 {
 
@@ -201,16 +206,148 @@ iaf_psc_alpha::State_::set( const DictionaryDatum& d,
   }
 }
 
+iaf_psc_alpha::Propagators_::Propagators_( const Parameters_& p,
+  const double h )
+{
+  // these P are independent
+  P11_ex_ = P22_ex_ = std::exp( -h / p.tau_ex_ );
+  P11_in_ = P22_in_ = std::exp( -h / p.tau_in_ );
+
+  P33_ = std::exp( -h / p.Tau_ );
+
+  expm1_tau_m_ = numerics::expm1( -h / p.Tau_ );
+
+  // these depend on the above. Please do not change the order.
+  P30_ = -p.Tau_ / p.C_ * numerics::expm1( -h / p.Tau_ );
+  P21_ex_ = h * P11_ex_;
+  P21_in_ = h * P11_in_;
+
+  // these are determined according to a numeric stability criterion
+  P31_ex_ = propagator_31( p.tau_ex_, p.Tau_, p.C_, h );
+  P32_ex_ = propagator_32( p.tau_ex_, p.Tau_, p.C_, h );
+  P31_in_ = propagator_31( p.tau_in_, p.Tau_, p.C_, h );
+  P32_in_ = propagator_32( p.tau_in_, p.Tau_, p.C_, h );
+
+  EPSCInitialValue_ = 1.0 * numerics::e / p.tau_ex_;
+  IPSCInitialValue_ = 1.0 * numerics::e / p.tau_in_;
+}
+
+PropagatorCache< iaf_psc_alpha::Propagators_ >::Key
+iaf_psc_alpha::Propagators_::key( const Parameters_& p, const double h )
+{
+  return { p.tau_ex_, p.tau_in_, p.Tau_, p.C_, h };
+}
+
 iaf_psc_alpha::Buffers_::Buffers_( iaf_psc_alpha& n )
   : logger_( n )
+  , batch_arrays_( 0 )
 {
 }
 
 iaf_psc_alpha::Buffers_::Buffers_( const Buffers_&, iaf_psc_alpha& n )
   : logger_( n )
+  , batch_arrays_( 0 )
+{
+}
+
+iaf_psc_alpha::Buffers_::~Buffers_()
+{
+  delete batch_arrays_;
+}
+
+iaf_psc_alpha::BatchArrays_::BatchArrays_()
+  : nodes_()
+  , loaded_( false )
 {
 }
 
+void
+iaf_psc_alpha::BatchArrays_::load()
+{
+  const size_t n = nodes_.size();
+  y0_.resize( n );
+  dI_ex_.resize( n );
+  I_ex_.resize( n );
+  dI_in_.resize( n );
+  I_in_.resize( n );
+  y3_.resize( n );
+  r_.resize( n );
+  P11_ex_.resize( n );
+  P21_ex_.resize( n );
+  P22_ex_.resize( n );
+  P31_ex_.resize( n );
+  P32_ex_.resize( n );
+  P11_in_.resize( n );
+  P21_in_.resize( n );
+  P22_in_.resize( n );
+  P31_in_.resize( n );
+  P32_in_.resize( n );
+  P30_.resize( n );
+  expm1_tau_m_.resize( n );
+  EPSCInitialValue_.resize( n );
+  IPSCInitialValue_.resize( n );
+  I_e_.resize( n );
+  Theta_.resize( n );
+  V_reset_.resize( n );
+  LowerBound_.resize( n );
+  refractory_counts_.resize( n );
+  weighted_spikes_ex_.resize( n );
+  weighted_spikes_in_.resize( n );
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_alpha& node = *nodes_[ i ];
+    const Propagators_& prop = *node.V_.prop_;
+    y0_[ i ] = node.S_.y0_;
+    dI_ex_[ i ] = node.S_.dI_ex_;
+    I_ex_[ i ] = node.S_.I_ex_;
+    dI_in_[ i ] = node.S_.dI_in_;
+    I_in_[ i ] = node.S_.I_in_;
+    y3_[ i ] = node.S_.y3_;
+    r_[ i ] = node.S_.r_;
+    P11_ex_[ i ] = prop.P11_ex_;
+    P21_ex_[ i ] = prop.P21_ex_;
+    P22_ex_[ i ] = prop.P22_ex_;
+    P31_ex_[ i ] = prop.P31_ex_;
+    P32_ex_[ i ] = prop.P32_ex_;
+    P11_in_[ i ] = prop.P11_in_;
+    P21_in_[ i ] = prop.P21_in_;
+    P22_in_[ i ] = prop.P22_in_;
+    P31_in_[ i ] = prop.P31_in_;
+    P32_in_[ i ] = prop.P32_in_;
+    P30_[ i ] = prop.P30_;
+    expm1_tau_m_[ i ] = prop.expm1_tau_m_;
+    EPSCInitialValue_[ i ] = prop.EPSCInitialValue_;
+    IPSCInitialValue_[ i ] = prop.IPSCInitialValue_;
+    I_e_[ i ] = node.P_.I_e_;
+    Theta_[ i ] = node.P_.Theta_;
+    V_reset_[ i ] = node.P_.V_reset_;
+    LowerBound_[ i ] = node.P_.LowerBound_;
+    refractory_counts_[ i ] = node.V_.RefractoryCounts_;
+  }
+
+  loaded_ = true;
+}
+
+void
+iaf_psc_alpha::BatchArrays_::store() const
+{
+  const size_t n = nodes_.size();
+  for ( size_t i = 0; i < n; ++i )
+  {
+    iaf_psc_alpha& node = *nodes_[ i ];
+    node.S_.y0_ = y0_[ i ];
+    node.S_.dI_ex_ = dI_ex_[ i ];
+    node.S_.I_ex_ = I_ex_[ i ];
+    node.S_.dI_in_ = dI_in_[ i ];
+    node.S_.I_in_ = I_in_[ i ];
+    node.S_.y3_ = y3_[ i ];
+    node.S_.r_ = r_[ i ];
+    node.V_.weighted_spikes_ex_ = weighted_spikes_ex_[ i ];
+    node.V_.weighted_spikes_in_ = weighted_spikes_in_[ i ];
+  }
+}
+
 
 /* ----------------------------------------------------------------
  * Default and copy constructor for node
@@ -254,6 +391,12 @@ iaf_psc_alpha::init_buffers_()
   B_.logger_.reset();
 
   Archiving_Node::clear_history();
+
+  // discard arrays of a run that ended without post_run_cleanup()
+  if ( B_.batch_arrays_ != 0 )
+  {
+    B_.batch_arrays_->loaded_ = false;
+  }
 }
 
 void
@@ -264,27 +407,14 @@ iaf_psc_alpha::calibrate()
 
   const double h = Time::get_resolution().get_ms();
 
-  // these P are independent
-  V_.P11_ex_ = V_.P22_ex_ = std::exp( -h / P_.tau_ex_ );
-  V_.P11_in_ = V_.P22_in_ = std::exp( -h / P_.tau_in_ );
-
-  V_.P33_ = std::exp( -h / P_.Tau_ );
-
-  V_.expm1_tau_m_ = numerics::expm1( -h / P_.Tau_ );
-
-  // these depend on the above. Please do not change the order.
-  V_.P30_ = -P_.Tau_ / P_.C_ * numerics::expm1( -h / P_.Tau_ );
-  V_.P21_ex_ = h * V_.P11_ex_;
-  V_.P21_in_ = h * V_.P11_in_;
-
-  // these are determined according to a numeric stability criterion
-  V_.P31_ex_ = propagator_31( P_.tau_ex_, P_.Tau_, P_.C_, h );
-  V_.P32_ex_ = propagator_32( P_.tau_ex_, P_.Tau_, P_.C_, h );
-  V_.P31_in_ = propagator_31( P_.tau_in_, P_.Tau_, P_.C_, h );
-  V_.P32_in_ = propagator_32( P_.tau_in_, P_.Tau_, P_.C_, h );
-
-  V_.EPSCInitialValue_ = 1.0 * numerics::e / P_.tau_ex_;
-  V_.IPSCInitialValue_ = 1.0 * numerics::e / P_.tau_in_;
+  // propagators depend on time constants and capacitance only and are
+  // shared by all neurons with identical values
+  const PropagatorCache< Propagators_ >::Key key = Propagators_::key( P_, h );
+  V_.prop_ = propagatorCache_.find( key );
+  if ( not V_.prop_ )
+  {
+    V_.prop_ = propagatorCache_.insert( key, Propagators_( P_, h ) );
+  }
 
   // TauR specifies the length of the absolute refractory period as
   // a double in ms. The grid based iaf_psc_alpha can only handle refractory
@@ -322,14 +452,16 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
     to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
   assert( from < to );
 
+  const Propagators_& prop = *V_.prop_;
+
   for ( long lag = from; lag < to; ++lag )
   {
     if ( S_.r_ == 0 )
     {
       // neuron not refractory
-      S_.y3_ = V_.P30_ * ( S_.y0_ + P_.I_e_ ) + V_.P31_ex_ * S_.dI_ex_
-        + V_.P32_ex_ * S_.I_ex_ + V_.P31_in_ * S_.dI_in_ + V_.P32_in_ * S_.I_in_
-        + V_.expm1_tau_m_ * S_.y3_ + S_.y3_;
+      S_.y3_ = prop.P30_ * ( S_.y0_ + P_.I_e_ ) + prop.P31_ex_ * S_.dI_ex_
+        + prop.P32_ex_ * S_.I_ex_ + prop.P31_in_ * S_.dI_in_
+        + prop.P32_in_ * S_.I_in_ + prop.expm1_tau_m_ * S_.y3_ + S_.y3_;
 
       // lower bound of membrane potential
       S_.y3_ = ( S_.y3_ < P_.LowerBound_ ? P_.LowerBound_ : S_.y3_ );
@@ -341,22 +473,22 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
     }
 
     // alpha shape EPSCs
-    S_.I_ex_ = V_.P21_ex_ * S_.dI_ex_ + V_.P22_ex_ * S_.I_ex_;
-    S_.dI_ex_ *= V_.P11_ex_;
+    S_.I_ex_ = prop.P21_ex_ * S_.dI_ex_ + prop.P22_ex_ * S_.I_ex_;
+    S_.dI_ex_ *= prop.P11_ex_;
 
     // Apply spikes delivered in this step; spikes arriving at T+1 have
     // an immediate effect on the state of the neuron
     V_.weighted_spikes_ex_ = B_.ex_spikes_.get_value( lag );
-    S_.dI_ex_ += V_.EPSCInitialValue_ * V_.weighted_spikes_ex_;
+    S_.dI_ex_ += prop.EPSCInitialValue_ * V_.weighted_spikes_ex_;
 
     // alpha shape EPSCs
-    S_.I_in_ = V_.P21_in_ * S_.dI_in_ + V_.P22_in_ * S_.I_in_;
-    S_.dI_in_ *= V_.P11_in_;
+    S_.I_in_ = prop.P21_in_ * S_.dI_in_ + prop.P22_in_ * S_.I_in_;
+    S_.dI_in_ *= prop.P11_in_;
 
     // Apply spikes delivered in this step; spikes arriving at T+1 have
     // an immediate effect on the state of the neuron
     V_.weighted_spikes_in_ = B_.in_spikes_.get_value( lag );
-    S_.dI_in_ += V_.IPSCInitialValue_ * V_.weighted_spikes_in_;
+    S_.dI_in_ += prop.IPSCInitialValue_ * V_.weighted_spikes_in_;
 
     // threshold crossing
     if ( S_.y3_ >= P_.Theta_ )
@@ -381,6 +513,167 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
   }
 }
 
+void
+iaf_psc_alpha::post_run_cleanup()
+{
+  // store the state of the batch starting at this node back to its nodes
+  if ( B_.batch_arrays_ != 0 and B_.batch_arrays_->loaded_ )
+  {
+    B_.batch_arrays_->store();
+    B_.batch_arrays_->loaded_ = false;
+  }
+}
+
+void
+iaf_psc_alpha::update_batch( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  assert(
+    to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  // The arrays are kept by the node starting the batch. Nodes, state and
+  // parameters are loaded in the first time slice of each call to Run.
+  if ( B_.batch_arrays_ == 0 )
+  {
+    B_.batch_arrays_ = new BatchArrays_();
+  }
+  BatchArrays_& arrays = *B_.batch_arrays_;
+  if ( not arrays.loaded_ )
+  {
+    BatchUpdate< iaf_psc_alpha >::select( first, last, arrays.nodes_ );
+    arrays.load();
+  }
+
+  BatchUpdate< iaf_psc_alpha > batch( first, last, arrays.nodes_ );
+  const size_t n = batch.size();
+  const size_t num_steps = to - from;
+
+  // input of the nodes of a block, one row of block_size values per step
+  const size_t block_size = BatchUpdate< iaf_psc_alpha >::block_size;
+  arrays.ex_spikes_.resize( num_steps * block_size );
+  arrays.in_spikes_.resize( num_steps * block_size );
+  arrays.currents_.resize( num_steps * block_size );
+  double* const ex_spikes = arrays.ex_spikes_.data();
+  double* const in_spikes = arrays.in_spikes_.data();
+  double* const currents = arrays.currents_.data();
+  const size_t last_row = ( num_steps - 1 ) * block_size; // last step
+
+  // state, propagators and parameters of all nodes, accessed through
+  // plain pointers, for which the compiler vectorizes the loops
+  double* const y0 = arrays.y0_.data();
+  double* const dI_ex = arrays.dI_ex_.data();
+  double* const I_ex = arrays.I_ex_.data();
+  double* const dI_in = arrays.dI_in_.data();
+  double* const I_in = arrays.I_in_.data();
+  double* const y3 = arrays.y3_.data();
+  int* const r = arrays.r_.data();
+  const double* const P11_ex = arrays.P11_ex_.data();
+  const double* const P21_ex = arrays.P21_ex_.data();
+  const double* const P22_ex = arrays.P22_ex_.data();
+  const double* const P31_ex = arrays.P31_ex_.data();
+  const double* const P32_ex = arrays.P32_ex_.data();
+  const double* const P11_in = arrays.P11_in_.data();
+  const double* const P21_in = arrays.P21_in_.data();
+  const double* const P22_in = arrays.P22_in_.data();
+  const double* const P31_in = arrays.P31_in_.data();
+  const double* const P32_in = arrays.P32_in_.data();
+  const double* const P30 = arrays.P30_.data();
+  const double* const expm1_tau_m = arrays.expm1_tau_m_.data();
+  const double* const EPSCInitialValue = arrays.EPSCInitialValue_.data();
+  const double* const IPSCInitialValue = arrays.IPSCInitialValue_.data();
+  const double* const I_e = arrays.I_e_.data();
+  const double* const Theta = arrays.Theta_.data();
+  const double* const V_reset = arrays.V_reset_.data();
+  const double* const LowerBound = arrays.LowerBound_.data();
+  const int* const refractory_counts = arrays.refractory_counts_.data();
+
+  // Advance the nodes block by block, so that the arrays of a block stay
+  // in the cache during the time slice, and each block step by step after
+  // reading its input from the ring buffers. The arithmetic is identical
+  // to update(). The new membrane potential is computed for all nodes of
+  // the block, and only taken over by nodes that are not refractory, so
+  // that the arithmetic has no branches.
+  double V[ block_size ];
+  for ( size_t begin = 0; begin < n; begin += block_size )
+  {
+    const size_t end = std::min( begin + block_size, n );
+
+    for ( size_t i = begin; i < end; ++i )
+    {
+      iaf_psc_alpha& node = batch.get_node( i );
+      const size_t j = i - begin;
+      node.B_.ex_spikes_.get_values( from, to, ex_spikes + j, block_size );
+      node.B_.in_spikes_.get_values( from, to, in_spikes + j, block_size );
+      node.B_.currents_.get_values( from, to, currents + j, block_size );
+      arrays.weighted_spikes_ex_[ i ] = ex_spikes[ last_row + j ];
+      arrays.weighted_spikes_in_[ i ] = in_spikes[ last_row + j ];
+    }
+
+    for ( long lag = from; lag < to; ++lag )
+    {
+      const size_t row = ( lag - from ) * block_size;
+
+#pragma omp simd
+      for ( size_t i = begin; i < end; ++i )
+      {
+        const double V_m = P30[ i ] * ( y0[ i ] + I_e[ i ] )
+          + P31_ex[ i ] * dI_ex[ i ] + P32_ex[ i ] * I_ex[ i ]
+          + P31_in[ i ] * dI_in[ i ] + P32_in[ i ] * I_in[ i ]
+          + expm1_tau_m[ i ] * y3[ i ] + y3[ i ];
+
+        // lower bound of membrane potential
+        V[ i - begin ] = ( V_m < LowerBound[ i ] ? LowerBound[ i ] : V_m );
+      }
+
+      // alpha shape PSCs and spikes delivered in this step
+#pragma omp simd
+      for ( size_t i = begin; i < end; ++i )
+      {
+        I_ex[ i ] = P21_ex[ i ] * dI_ex[ i ] + P22_ex[ i ] * I_ex[ i ];
+        dI_ex[ i ] = dI_ex[ i ] * P11_ex[ i ]
+          + EPSCInitialValue[ i ] * ex_spikes[ row + i - begin ];
+
+        I_in[ i ] = P21_in[ i ] * dI_in[ i ] + P22_in[ i ] * I_in[ i ];
+        dI_in[ i ] = dI_in[ i ] * P11_in[ i ]
+          + IPSCInitialValue[ i ] * in_spikes[ row + i - begin ];
+      }
+
+      // refractoriness and threshold crossing
+      for ( size_t i = begin; i < end; ++i )
+      {
+        if ( r[ i ] == 0 )
+        {
+          y3[ i ] = V[ i - begin ];
+        }
+        else
+        {
+          --r[ i ];
+        }
+
+        if ( y3[ i ] >= Theta[ i ] )
+        {
+          r[ i ] = refractory_counts[ i ];
+          y3[ i ] = V_reset[ i ];
+          batch.add_spike( i, lag );
+        }
+      }
+
+      // set new input current
+#pragma omp simd
+      for ( size_t i = begin; i < end; ++i )
+      {
+        y0[ i ] = currents[ row + i - begin ];
+      }
+    }
+  }
+
+  batch.finish( origin, from, to );
+}
+
 void
 iaf_psc_alpha::handle( SpikeEvent& e )
 {
@@ -23,11 +23,15 @@
 #ifndef IAF_PSC_ALPHA_H
 #define IAF_PSC_ALPHA_H
 
+// C++ includes:
+#include <vector>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "propagator_cache.h"
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
@@ -158,6 +162,8 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void post_run_cleanup();
+
 private:
   void init_state_( const Node& proto );
   void init_buffers_();
@@ -165,9 +171,19 @@ private:
 
   void update( Time const&, const long, const long );
 
-  // The next two classes need to be friends to access the State_ class/member
+  bool supports_batch_update() const;
+  void update_batch( std::vector< Node* >::const_iterator,
+    std::vector< Node* >::const_iterator,
+    Time const&,
+    const long,
+    const long );
+  bool is_batch_updatable_() const;
+
+  // The next three classes need to be friends to access the State_
+  // class/member
   friend class RecordablesMap< iaf_psc_alpha >;
   friend class UniversalDataLogger< iaf_psc_alpha >;
+  friend class BatchUpdate< iaf_psc_alpha >;
 
   // ----------------------------------------------------------------
 
@@ -245,11 +261,74 @@ private:
 
   // ----------------------------------------------------------------
 
+  /**
+   * State, propagators, parameters and input of the nodes of a batch in
+   * contiguous arrays, see update_batch(). The arrays are kept by the
+   * node that starts the batch and reused in all time slices of a call to
+   * Run. Nodes, state and parameters are loaded in the first time slice,
+   * and the state is stored back to the nodes by post_run_cleanup().
+   */
+  struct BatchArrays_
+  {
+    BatchArrays_();
+
+    //! nodes advanced by the batch kernel
+    std::vector< iaf_psc_alpha* > nodes_;
+
+    //! true if the arrays hold the state of nodes_
+    bool loaded_;
+
+    std::vector< double > y0_;
+    std::vector< double > dI_ex_;
+    std::vector< double > I_ex_;
+    std::vector< double > dI_in_;
+    std::vector< double > I_in_;
+    std::vector< double > y3_;
+    std::vector< int > r_;
+    std::vector< double > P11_ex_;
+    std::vector< double > P21_ex_;
+    std::vector< double > P22_ex_;
+    std::vector< double > P31_ex_;
+    std::vector< double > P32_ex_;
+    std::vector< double > P11_in_;
+    std::vector< double > P21_in_;
+    std::vector< double > P22_in_;
+    std::vector< double > P31_in_;
+    std::vector< double > P32_in_;
+    std::vector< double > P30_;
+    std::vector< double > expm1_tau_m_;
+    std::vector< double > EPSCInitialValue_;
+    std::vector< double > IPSCInitialValue_;
+    std::vector< double > I_e_;
+    std::vector< double > Theta_;
+    std::vector< double > V_reset_;
+    std::vector< double > LowerBound_;
+    std::vector< int > refractory_counts_;
+
+    //! input in the last step of the last time slice
+    std::vector< double > weighted_spikes_ex_;
+    std::vector< double > weighted_spikes_in_;
+
+    //! input of a block of nodes, one row per step
+    std::vector< double > ex_spikes_;
+    std::vector< double > in_spikes_;
+    std::vector< double > currents_;
+
+    //! Load state, propagators and parameters of nodes_
+    void load();
+
+    //! Store state back to nodes_
+    void store() const;
+  };
+
+  // ----------------------------------------------------------------
+
   struct Buffers_
   {
 
     Buffers_( iaf_psc_alpha& );
     Buffers_( const Buffers_&, iaf_psc_alpha& );
+    ~Buffers_();
 
     /** buffers and summs up incoming spikes/currents */
     RingBuffer ex_spikes_;
@@ -258,11 +337,18 @@ private:
 
     //! Logger for all analog data
     UniversalDataLogger< iaf_psc_alpha > logger_;
+
+    //! Arrays of the batch starting at this node, see update_batch()
+    BatchArrays_* batch_arrays_;
   };
 
   // ----------------------------------------------------------------
 
-  struct Variables_
+  /**
+   * Propagators of the exact integration, shared by all neurons with
+   * identical time constants and capacitance.
+   */
+  struct Propagators_
   {
 
     /** Amplitude of the synaptic current.
@@ -271,7 +357,6 @@ private:
      */
     double EPSCInitialValue_;
     double IPSCInitialValue_;
-    int RefractoryCounts_;
 
     double P11_ex_;
     double P21_ex_;
@@ -287,6 +372,23 @@ private:
     double P33_;
     double expm1_tau_m_;
 
+    //! Compute propagators for parameters p and resolution h
+    Propagators_( const Parameters_& p, const double h );
+
+    //! Return values the propagators depend on
+    static PropagatorCache< Propagators_ >::Key key( const Parameters_& p,
+      const double h );
+  };
+
+  // ----------------------------------------------------------------
+
+  struct Variables_
+  {
+    //! Propagators from propagatorCache_
+    PropagatorCache< Propagators_ >::Entry prop_;
+
+    int RefractoryCounts_;
+
     double weighted_spikes_ex_;
     double weighted_spikes_in_;
   };
@@ -341,6 +443,9 @@ private:
 
   //! Mapping of recordables names to access functions
   static RecordablesMap< iaf_psc_alpha > recordablesMap_;
+
+  //! Propagators shared by all instances
+  static PropagatorCache< Propagators_ > propagatorCache_;
 };
 
 inline port
@@ -385,6 +490,18 @@ iaf_psc_alpha::handles_test_event( DataLoggingRequest& dlr,
   return B_.logger_.connect_logging_device( dlr, recordablesMap_ );
 }
 
+inline bool
+iaf_psc_alpha::supports_batch_update() const
+{
+  return true;
+}
+
+inline bool
+iaf_psc_alpha::is_batch_updatable_() const
+{
+  return not B_.logger_.is_recording();
+}
+
 inline void
 iaf_psc_alpha::get_status( DictionaryDatum& d ) const
 {
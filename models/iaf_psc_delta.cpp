@@ -25,12 +25,14 @@
 #include "iaf_psc_delta.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
 #include "numerics.h"
 
 // Includes from nestkernel:
+#include "batch_update.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "universal_data_logger_impl.h"
@@ -189,14 +191,73 @@ nest::iaf_psc_delta::State_::set( const DictionaryDatum& d,
 
 nest::iaf_psc_delta::Buffers_::Buffers_( iaf_psc_delta& n )
   : logger_( n )
+  , batch_arrays_( 0 )
 {
 }
 
 nest::iaf_psc_delta::Buffers_::Buffers_( const Buffers_&, iaf_psc_delta& n )
   : logger_( n )
+  , batch_arrays_( 0 )
 {
 }
 
+nest::iaf_psc_delta::Buffers_::~Buffers_()
+{
+  delete batch_arrays_;
+}
+
+nest::iaf_psc_delta::BatchArrays_::BatchArrays_()
+  : nodes_()
+  , loaded_( false )
+{
+}
+
+void
+nest::iaf_psc_delta::BatchArrays_::load()
+{
+  const size_t n = nodes_.size();
+  y0_.resize( n );
+  y3_.resize( n );
+  r_.resize( n );
+  P30_.resize( n );
+  P33_.resize( n );
+  I_e_.resize( n );
+  V_th_.resize( n );
+  V_min_.resize( n );
+  V_reset_.resize( n );
+  refractory_counts_.resize( n );
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_delta& node = *nodes_[ i ];
+    y0_[ i ] = node.S_.y0_;
+    y3_[ i ] = node.S_.y3_;
+    r_[ i ] = node.S_.r_;
+    P30_[ i ] = node.V_.P30_;
+    P33_[ i ] = node.V_.P33_;
+    I_e_[ i ] = node.P_.I_e_;
+    V_th_[ i ] = node.P_.V_th_;
+    V_min_[ i ] = node.P_.V_min_;
+    V_reset_[ i ] = node.P_.V_reset_;
+    refractory_counts_[ i ] = node.V_.RefractoryCounts_;
+  }
+
+  loaded_ = true;
+}
+
+void
+nest::iaf_psc_delta::BatchArrays_::store() const
+{
+  const size_t n = nodes_.size();
+  for ( size_t i = 0; i < n; ++i )
+  {
+    iaf_psc_delta& node = *nodes_[ i ];
+    node.S_.y0_ = y0_[ i ];
+    node.S_.y3_ = y3_[ i ];
+    node.S_.r_ = r_[ i ];
+  }
+}
+
 /* ----------------------------------------------------------------
  * Default and copy constructor for node
  * ---------------------------------------------------------------- */
@@ -236,6 +297,12 @@ nest::iaf_psc_delta::init_buffers_()
   B_.currents_.clear(); // includes resize
   B_.logger_.reset();   // includes resize
   Archiving_Node::clear_history();
+
+  // discard arrays of a run that ended without post_run_cleanup()
+  if ( B_.batch_arrays_ != 0 )
+  {
+    B_.batch_arrays_->loaded_ = false;
+  }
 }
 
 void
@@ -343,6 +410,131 @@ nest::iaf_psc_delta::update( Time const& origin,
   }
 }
 
+void
+nest::iaf_psc_delta::post_run_cleanup()
+{
+  // store the state of the batch starting at this node back to its nodes
+  if ( B_.batch_arrays_ != 0 and B_.batch_arrays_->loaded_ )
+  {
+    B_.batch_arrays_->store();
+    B_.batch_arrays_->loaded_ = false;
+  }
+}
+
+void
+nest::iaf_psc_delta::update_batch( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  assert(
+    to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  // The arrays are kept by the node starting the batch. Nodes, state and
+  // parameters are loaded in the first time slice of each call to Run.
+  if ( B_.batch_arrays_ == 0 )
+  {
+    B_.batch_arrays_ = new BatchArrays_();
+  }
+  BatchArrays_& arrays = *B_.batch_arrays_;
+  if ( not arrays.loaded_ )
+  {
+    BatchUpdate< iaf_psc_delta >::select( first, last, arrays.nodes_ );
+    arrays.load();
+  }
+
+  BatchUpdate< iaf_psc_delta > batch( first, last, arrays.nodes_ );
+  const size_t n = batch.size();
+  const size_t num_steps = to - from;
+
+  // input of the nodes of a block, one row of block_size values per step
+  const size_t block_size = BatchUpdate< iaf_psc_delta >::block_size;
+  arrays.spikes_.resize( num_steps * block_size );
+  arrays.currents_.resize( num_steps * block_size );
+  double* const spikes = arrays.spikes_.data();
+  double* const currents = arrays.currents_.data();
+
+  // state, propagators and parameters of all nodes, accessed through
+  // plain pointers, for which the compiler vectorizes the loops
+  double* const y0 = arrays.y0_.data();
+  double* const y3 = arrays.y3_.data();
+  int* const r = arrays.r_.data();
+  const double* const P30 = arrays.P30_.data();
+  const double* const P33 = arrays.P33_.data();
+  const double* const I_e = arrays.I_e_.data();
+  const double* const V_th = arrays.V_th_.data();
+  const double* const V_min = arrays.V_min_.data();
+  const double* const V_reset = arrays.V_reset_.data();
+  const int* const refractory_counts = arrays.refractory_counts_.data();
+
+  // Advance the nodes block by block, so that the arrays of a block stay
+  // in the cache during the time slice, and each block step by step after
+  // reading its input from the ring buffers. The arithmetic is identical
+  // to update(). The new membrane potential is computed for all nodes of
+  // the block, and only taken over by nodes that are not refractory, so
+  // that the arithmetic has no branches.
+  // Spikes arriving during the refractory period are ignored.
+  double V[ block_size ];
+  for ( size_t begin = 0; begin < n; begin += block_size )
+  {
+    const size_t end = std::min( begin + block_size, n );
+
+    for ( size_t i = begin; i < end; ++i )
+    {
+      iaf_psc_delta& node = batch.get_node( i );
+      const size_t j = i - begin;
+      node.B_.spikes_.get_values( from, to, spikes + j, block_size );
+      node.B_.currents_.get_values( from, to, currents + j, block_size );
+    }
+
+    for ( long lag = from; lag < to; ++lag )
+    {
+      const size_t row = ( lag - from ) * block_size;
+
+#pragma omp simd
+      for ( size_t i = begin; i < end; ++i )
+      {
+        const double V_m = P30[ i ] * ( y0[ i ] + I_e[ i ] )
+          + P33[ i ] * y3[ i ] + spikes[ row + i - begin ];
+
+        // lower bound of membrane potential
+        V[ i - begin ] = ( V_m < V_min[ i ] ? V_min[ i ] : V_m );
+      }
+
+      // refractoriness and threshold crossing
+      for ( size_t i = begin; i < end; ++i )
+      {
+        if ( r[ i ] == 0 )
+        {
+          y3[ i ] = V[ i - begin ];
+        }
+        else
+        {
+          --r[ i ];
+        }
+
+        if ( y3[ i ] >= V_th[ i ] )
+        {
+          r[ i ] = refractory_counts[ i ];
+          y3[ i ] = V_reset[ i ];
+          batch.add_spike( i, lag );
+        }
+      }
+
+      // set new input current
+#pragma omp simd
+      for ( size_t i = begin; i < end; ++i )
+      {
+        y0[ i ] = currents[ row + i - begin ];
+      }
+    }
+  }
+
+  batch.finish( origin, from, to );
+}
+
 void
 nest::iaf_psc_delta::handle( SpikeEvent& e )
 {
@@ -23,6 +23,9 @@
 #ifndef IAF_PSC_DELTA_H
 #define IAF_PSC_DELTA_H
 
+// C++ includes:
+#include <vector>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
@@ -149,6 +152,8 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void post_run_cleanup();
+
 private:
   void init_state_( const Node& proto );
   void init_buffers_();
@@ -156,9 +161,19 @@ private:
 
   void update( Time const&, const long, const long );
 
-  // The next two classes need to be friends to access the State_ class/member
+  bool supports_batch_update() const;
+  void update_batch( std::vector< Node* >::const_iterator,
+    std::vector< Node* >::const_iterator,
+    Time const&,
+    const long,
+    const long );
+  bool is_batch_updatable_() const;
+
+  // The next three classes need to be friends to access the State_
+  // class/member
   friend class RecordablesMap< iaf_psc_delta >;
   friend class UniversalDataLogger< iaf_psc_delta >;
+  friend class BatchUpdate< iaf_psc_delta >;
 
   // ----------------------------------------------------------------
 
@@ -238,6 +253,47 @@ private:
 
   // ----------------------------------------------------------------
 
+  /**
+   * State, propagators, parameters and input of the nodes of a batch in
+   * contiguous arrays, see update_batch(). The arrays are kept by the
+   * node that starts the batch and reused in all time slices of a call to
+   * Run. Nodes, state and parameters are loaded in the first time slice,
+   * and the state is stored back to the nodes by post_run_cleanup().
+   */
+  struct BatchArrays_
+  {
+    BatchArrays_();
+
+    //! nodes advanced by the batch kernel
+    std::vector< iaf_psc_delta* > nodes_;
+
+    //! true if the arrays hold the state of nodes_
+    bool loaded_;
+
+    std::vector< double > y0_;
+    std::vector< double > y3_;
+    std::vector< int > r_;
+    std::vector< double > P30_;
+    std::vector< double > P33_;
+    std::vector< double > I_e_;
+    std::vector< double > V_th_;
+    std::vector< double > V_min_;
+    std::vector< double > V_reset_;
+    std::vector< int > refractory_counts_;
+
+    //! input of a block of nodes, one row per step
+    std::vector< double > spikes_;
+    std::vector< double > currents_;
+
+    //! Load state, propagators and parameters of nodes_
+    void load();
+
+    //! Store state back to nodes_
+    void store() const;
+  };
+
+  // ----------------------------------------------------------------
+
   /**
    * Buffers of the model.
    */
@@ -245,6 +301,7 @@ private:
   {
     Buffers_( iaf_psc_delta& );
     Buffers_( const Buffers_&, iaf_psc_delta& );
+    ~Buffers_();
 
     /** buffers and summs up incoming spikes/currents */
     RingBuffer spikes_;
@@ -252,6 +309,9 @@ private:
 
     //! Logger for all analog data
     UniversalDataLogger< iaf_psc_delta > logger_;
+
+    //! Arrays of the batch starting at this node, see update_batch()
+    BatchArrays_* batch_arrays_;
   };
 
   // ----------------------------------------------------------------
@@ -339,6 +399,22 @@ iaf_psc_delta::handles_test_event( DataLoggingRequest& dlr,
   return B_.logger_.connect_logging_device( dlr, recordablesMap_ );
 }
 
+inline bool
+iaf_psc_delta::supports_batch_update() const
+{
+  return true;
+}
+
+/**
+ * Spikes arriving during the refractory period are handled by update()
+ * only, since they require an exponential per step.
+ */
+inline bool
+iaf_psc_delta::is_batch_updatable_() const
+{
+  return not( B_.logger_.is_recording() or P_.with_refr_input_ );
+}
+
 inline void
 iaf_psc_delta::get_status( DictionaryDatum& d ) const
 {
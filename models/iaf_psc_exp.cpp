@@ -23,6 +23,7 @@
 #include "iaf_psc_exp.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -30,6 +31,7 @@
 #include "propagator_stability.h"
 
 // Includes from nestkernel:
+#include "batch_update.h"
 #include "event_delivery_manager_impl.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
@@ -47,6 +49,9 @@
 
 nest::RecordablesMap< nest::iaf_psc_exp > nest::iaf_psc_exp::recordablesMap_;
 
+nest::PropagatorCache< nest::iaf_psc_exp::Propagators_ >
+  nest::iaf_psc_exp::propagatorCache_;
+
 namespace nest
 {
 // Override the create() method with one call to RecordablesMap::insert_()
@@ -183,14 +188,128 @@ nest::iaf_psc_exp::State_::set( const DictionaryDatum& d,
   }
 }
 
+nest::iaf_psc_exp::Propagators_::Propagators_( const Parameters_& p,
+  const double h )
+{
+  // numbering of state vaiables: i_0 = 0, i_syn_ = 1, V_m_ = 2
+
+  // commented out propagators: forward Euler
+  // needed to exactly reproduce Tsodyks network
+
+  // these P are independent
+  P11ex_ = std::exp( -h / p.tau_ex_ );
+  // P11ex_ = 1.0-h/tau_ex_;
+
+  P11in_ = std::exp( -h / p.tau_in_ );
+  // P11in_ = 1.0-h/tau_in_;
+
+  P22_ = std::exp( -h / p.Tau_ );
+  // P22_ = 1.0-h/Tau_;
+
+  // these are determined according to a numeric stability criterion
+  P21ex_ = propagator_32( p.tau_ex_, p.Tau_, p.C_, h );
+  P21in_ = propagator_32( p.tau_in_, p.Tau_, p.C_, h );
+
+  // P21ex_ = h/C_;
+  // P21in_ = h/C_;
+
+  P20_ = p.Tau_ / p.C_ * ( 1.0 - P22_ );
+  // P20_ = h/C_;
+}
+
+nest::PropagatorCache< nest::iaf_psc_exp::Propagators_ >::Key
+nest::iaf_psc_exp::Propagators_::key( const Parameters_& p, const double h )
+{
+  return { p.tau_ex_, p.tau_in_, p.Tau_, p.C_, h };
+}
+
 nest::iaf_psc_exp::Buffers_::Buffers_( iaf_psc_exp& n )
   : logger_( n )
+  , batch_arrays_( 0 )
 {
 }
 
 nest::iaf_psc_exp::Buffers_::Buffers_( const Buffers_&, iaf_psc_exp& n )
   : logger_( n )
+  , batch_arrays_( 0 )
+{
+}
+
+nest::iaf_psc_exp::Buffers_::~Buffers_()
+{
+  delete batch_arrays_;
+}
+
+nest::iaf_psc_exp::BatchArrays_::BatchArrays_()
+  : nodes_()
+  , loaded_( false )
+{
+}
+
+void
+nest::iaf_psc_exp::BatchArrays_::load()
+{
+  const size_t n = nodes_.size();
+  V_m_.resize( n );
+  i_syn_ex_.resize( n );
+  i_syn_in_.resize( n );
+  i_0_.resize( n );
+  i_1_.resize( n );
+  r_ref_.resize( n );
+  P20_.resize( n );
+  P11ex_.resize( n );
+  P11in_.resize( n );
+  P21ex_.resize( n );
+  P21in_.resize( n );
+  P22_.resize( n );
+  I_e_.resize( n );
+  Theta_.resize( n );
+  V_reset_.resize( n );
+  refractory_counts_.resize( n );
+  weighted_spikes_ex_.resize( n );
+  weighted_spikes_in_.resize( n );
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_exp& node = *nodes_[ i ];
+    const Propagators_& prop = *node.V_.prop_;
+    V_m_[ i ] = node.S_.V_m_;
+    i_syn_ex_[ i ] = node.S_.i_syn_ex_;
+    i_syn_in_[ i ] = node.S_.i_syn_in_;
+    i_0_[ i ] = node.S_.i_0_;
+    i_1_[ i ] = node.S_.i_1_;
+    r_ref_[ i ] = node.S_.r_ref_;
+    P20_[ i ] = prop.P20_;
+    P11ex_[ i ] = prop.P11ex_;
+    P11in_[ i ] = prop.P11in_;
+    P21ex_[ i ] = prop.P21ex_;
+    P21in_[ i ] = prop.P21in_;
+    P22_[ i ] = prop.P22_;
+    I_e_[ i ] = node.P_.I_e_;
+    Theta_[ i ] = node.P_.Theta_;
+    V_reset_[ i ] = node.P_.V_reset_;
+    refractory_counts_[ i ] = node.V_.RefractoryCounts_;
+  }
+
+  loaded_ = true;
+}
+
+void
+nest::iaf_psc_exp::BatchArrays_::store() const
 {
+  const size_t n = nodes_.size();
+  for ( size_t i = 0; i < n; ++i )
+  {
+    iaf_psc_exp& node = *nodes_[ i ];
+    node.S_.V_m_ = V_m_[ i ];
+    node.S_.i_syn_ex_ = i_syn_ex_[ i ];
+    node.S_.i_syn_in_ = i_syn_in_[ i ];
+    node.S_.i_0_ = i_0_[ i ];
+    node.S_.i_1_ = i_1_[ i ];
+    node.S_.r_ref_ = r_ref_[ i ];
+    node.V_.weighted_spikes_ex_ = weighted_spikes_ex_[ i ];
+    node.V_.weighted_spikes_in_ = weighted_spikes_in_[ i ];
+  }
 }
 
 /* ----------------------------------------------------------------
@@ -233,6 +352,12 @@ nest::iaf_psc_exp::init_buffers_()
   B_.currents_.clear();  // includes resize
   B_.logger_.reset();
   Archiving_Node::clear_history();
+
+  // discard arrays of a run that ended without post_run_cleanup()
+  if ( B_.batch_arrays_ != 0 )
+  {
+    B_.batch_arrays_->loaded_ = false;
+  }
 }
 
 void
@@ -244,30 +369,14 @@ nest::iaf_psc_exp::calibrate()
 
   const double h = Time::get_resolution().get_ms();
 
-  // numbering of state vaiables: i_0 = 0, i_syn_ = 1, V_m_ = 2
-
-  // commented out propagators: forward Euler
-  // needed to exactly reproduce Tsodyks network
-
-  // these P are independent
-  V_.P11ex_ = std::exp( -h / P_.tau_ex_ );
-  // P11ex_ = 1.0-h/tau_ex_;
-
-  V_.P11in_ = std::exp( -h / P_.tau_in_ );
-  // P11in_ = 1.0-h/tau_in_;
-
-  V_.P22_ = std::exp( -h / P_.Tau_ );
-  // P22_ = 1.0-h/Tau_;
-
-  // these are determined according to a numeric stability criterion
-  V_.P21ex_ = propagator_32( P_.tau_ex_, P_.Tau_, P_.C_, h );
-  V_.P21in_ = propagator_32( P_.tau_in_, P_.Tau_, P_.C_, h );
-
-  // P21ex_ = h/C_;
-  // P21in_ = h/C_;
-
-  V_.P20_ = P_.Tau_ / P_.C_ * ( 1.0 - V_.P22_ );
-  // P20_ = h/C_;
+  // propagators depend on time constants and capacitance only and are
+  // shared by all neurons with identical values
+  const PropagatorCache< Propagators_ >::Key key = Propagators_::key( P_, h );
+  V_.prop_ = propagatorCache_.find( key );
+  if ( not V_.prop_ )
+  {
+    V_.prop_ = propagatorCache_.insert( key, Propagators_( P_, h ) );
+  }
 
   // t_ref_ specifies the length of the absolute refractory period as
   // a double in ms. The grid based iaf_psc_exp can only handle refractory
@@ -298,13 +407,15 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
     to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
   assert( from < to );
 
+  const Propagators_& prop = *V_.prop_;
+
   // evolve from timestep 'from' to timestep 'to' with steps of h each
   for ( long lag = from; lag < to; ++lag )
   {
     if ( S_.r_ref_ == 0 ) // neuron not refractory, so evolve V
     {
-      S_.V_m_ = S_.V_m_ * V_.P22_ + S_.i_syn_ex_ * V_.P21ex_
-        + S_.i_syn_in_ * V_.P21in_ + ( P_.I_e_ + S_.i_0_ ) * V_.P20_;
+      S_.V_m_ = S_.V_m_ * prop.P22_ + S_.i_syn_ex_ * prop.P21ex_
+        + S_.i_syn_in_ * prop.P21in_ + ( P_.I_e_ + S_.i_0_ ) * prop.P20_;
     }
     else
     {
@@ -312,11 +423,11 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
     } // neuron is absolute refractory
 
     // exponential decaying PSCs
-    S_.i_syn_ex_ *= V_.P11ex_;
-    S_.i_syn_in_ *= V_.P11in_;
+    S_.i_syn_ex_ *= prop.P11ex_;
+    S_.i_syn_in_ *= prop.P11in_;
 
     // add evolution of presynaptic input current
-    S_.i_syn_ex_ += ( 1. - V_.P11ex_ ) * S_.i_1_;
+    S_.i_syn_ex_ += ( 1. - prop.P11ex_ ) * S_.i_1_;
 
     // the spikes arriving at T+1 have an immediate effect on the state of the
     // neuron
@@ -347,6 +458,154 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
   }
 }
 
+void
+nest::iaf_psc_exp::post_run_cleanup()
+{
+  // store the state of the batch starting at this node back to its nodes
+  if ( B_.batch_arrays_ != 0 and B_.batch_arrays_->loaded_ )
+  {
+    B_.batch_arrays_->store();
+    B_.batch_arrays_->loaded_ = false;
+  }
+}
+
+void
+nest::iaf_psc_exp::update_batch( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  const Time& origin,
+  const long from,
+  const long to )
+{
+  assert(
+    to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  // The arrays are kept by the node starting the batch. Nodes, state and
+  // parameters are loaded in the first time slice of each call to Run.
+  if ( B_.batch_arrays_ == 0 )
+  {
+    B_.batch_arrays_ = new BatchArrays_();
+  }
+  BatchArrays_& arrays = *B_.batch_arrays_;
+  if ( not arrays.loaded_ )
+  {
+    BatchUpdate< iaf_psc_exp >::select( first, last, arrays.nodes_ );
+    arrays.load();
+  }
+
+  BatchUpdate< iaf_psc_exp > batch( first, last, arrays.nodes_ );
+  const size_t n = batch.size();
+  const size_t num_steps = to - from;
+
+  // input of the nodes of a block, one row of block_size values per step
+  const size_t block_size = BatchUpdate< iaf_psc_exp >::block_size;
+  arrays.spikes_ex_.resize( num_steps * block_size );
+  arrays.spikes_in_.resize( num_steps * block_size );
+  arrays.currents_0_.resize( num_steps * block_size );
+  arrays.currents_1_.resize( num_steps * block_size );
+  double* const spikes_ex = arrays.spikes_ex_.data();
+  double* const spikes_in = arrays.spikes_in_.data();
+  double* const currents_0 = arrays.currents_0_.data();
+  double* const currents_1 = arrays.currents_1_.data();
+  const size_t last_row = ( num_steps - 1 ) * block_size; // last step
+
+  // state, propagators and parameters of all nodes, accessed through
+  // plain pointers, for which the compiler vectorizes the loops
+  double* const V_m = arrays.V_m_.data();
+  double* const i_syn_ex = arrays.i_syn_ex_.data();
+  double* const i_syn_in = arrays.i_syn_in_.data();
+  double* const i_0 = arrays.i_0_.data();
+  double* const i_1 = arrays.i_1_.data();
+  int* const r_ref = arrays.r_ref_.data();
+  const double* const P20 = arrays.P20_.data();
+  const double* const P11ex = arrays.P11ex_.data();
+  const double* const P11in = arrays.P11in_.data();
+  const double* const P21ex = arrays.P21ex_.data();
+  const double* const P21in = arrays.P21in_.data();
+  const double* const P22 = arrays.P22_.data();
+  const double* const I_e = arrays.I_e_.data();
+  const double* const Theta = arrays.Theta_.data();
+  const double* const V_reset = arrays.V_reset_.data();
+  const int* const refractory_counts = arrays.refractory_counts_.data();
+
+  // Advance the nodes block by block, so that the arrays of a block stay
+  // in the cache during the time slice, and each block step by step after
+  // reading its input from the ring buffers. The arithmetic is identical
+  // to update(). The new membrane potential is computed for all nodes of
+  // the block, and only taken over by nodes that are not refractory, so
+  // that the arithmetic has no branches.
+  double V[ block_size ];
+  for ( size_t begin = 0; begin < n; begin += block_size )
+  {
+    const size_t end = std::min( begin + block_size, n );
+
+    for ( size_t i = begin; i < end; ++i )
+    {
+      iaf_psc_exp& node = batch.get_node( i );
+      const size_t j = i - begin;
+      node.B_.spikes_ex_.get_values( from, to, spikes_ex + j, block_size );
+      node.B_.spikes_in_.get_values( from, to, spikes_in + j, block_size );
+      node.B_.currents_[ 0 ].get_values( from, to, currents_0 + j, block_size );
+      node.B_.currents_[ 1 ].get_values( from, to, currents_1 + j, block_size );
+      arrays.weighted_spikes_ex_[ i ] = spikes_ex[ last_row + j ];
+      arrays.weighted_spikes_in_[ i ] = spikes_in[ last_row + j ];
+    }
+
+    for ( long lag = from; lag < to; ++lag )
+    {
+      const size_t row = ( lag - from ) * block_size;
+
+#pragma omp simd
+      for ( size_t i = begin; i < end; ++i )
+      {
+        V[ i - begin ] = V_m[ i ] * P22[ i ] + i_syn_ex[ i ] * P21ex[ i ]
+          + i_syn_in[ i ] * P21in[ i ] + ( I_e[ i ] + i_0[ i ] ) * P20[ i ];
+      }
+
+      // exponential decaying PSCs, evolution of presynaptic input current
+      // and spikes arriving at T+1
+#pragma omp simd
+      for ( size_t i = begin; i < end; ++i )
+      {
+        i_syn_ex[ i ] = i_syn_ex[ i ] * P11ex[ i ]
+          + ( 1. - P11ex[ i ] ) * i_1[ i ] + spikes_ex[ row + i - begin ];
+        i_syn_in[ i ] =
+          i_syn_in[ i ] * P11in[ i ] + spikes_in[ row + i - begin ];
+      }
+
+      // refractoriness and threshold crossing
+      for ( size_t i = begin; i < end; ++i )
+      {
+        if ( r_ref[ i ] == 0 ) // neuron not refractory, so evolve V
+        {
+          V_m[ i ] = V[ i - begin ];
+        }
+        else
+        {
+          --r_ref[ i ];
+        } // neuron is absolute refractory
+
+        if ( V_m[ i ] >= Theta[ i ] ) // threshold crossing
+        {
+          r_ref[ i ] = refractory_counts[ i ];
+          V_m[ i ] = V_reset[ i ];
+          batch.add_spike( i, lag );
+        }
+      }
+
+      // set new input current
+#pragma omp simd
+      for ( size_t i = begin; i < end; ++i )
+      {
+        i_0[ i ] = currents_0[ row + i - begin ];
+        i_1[ i ] = currents_1[ row + i - begin ];
+      }
+    }
+  }
+
+  batch.finish( origin, from, to );
+}
+
 void
 nest::iaf_psc_exp::handle( SpikeEvent& e )
 {
@@ -23,11 +23,15 @@
 #ifndef IAF_PSC_EXP_H
 #define IAF_PSC_EXP_H
 
+// C++ includes:
+#include <vector>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "propagator_cache.h"
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
@@ -161,6 +165,8 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void post_run_cleanup();
+
 private:
   void init_state_( const Node& proto );
   void init_buffers_();
@@ -168,9 +174,19 @@ private:
 
   void update( const Time&, const long, const long );
 
-  // The next two classes need to be friends to access the State_ class/member
+  bool supports_batch_update() const;
+  void update_batch( std::vector< Node* >::const_iterator,
+    std::vector< Node* >::const_iterator,
+    const Time&,
+    const long,
+    const long );
+  bool is_batch_updatable_() const;
+
+  // The next three classes need to be friends to access the State_
+  // class/member
   friend class RecordablesMap< iaf_psc_exp >;
   friend class UniversalDataLogger< iaf_psc_exp >;
+  friend class BatchUpdate< iaf_psc_exp >;
 
   // ----------------------------------------------------------------
 
@@ -250,6 +266,59 @@ private:
 
   // ----------------------------------------------------------------
 
+  /**
+   * State, propagators, parameters and input of the nodes of a batch in
+   * contiguous arrays, see update_batch(). The arrays are kept by the
+   * node that starts the batch and reused in all time slices of a call to
+   * Run. Nodes, state and parameters are loaded in the first time slice,
+   * and the state is stored back to the nodes by post_run_cleanup().
+   */
+  struct BatchArrays_
+  {
+    BatchArrays_();
+
+    //! nodes advanced by the batch kernel
+    std::vector< iaf_psc_exp* > nodes_;
+
+    //! true if the arrays hold the state of nodes_
+    bool loaded_;
+
+    std::vector< double > V_m_;
+    std::vector< double > i_syn_ex_;
+    std::vector< double > i_syn_in_;
+    std::vector< double > i_0_;
+    std::vector< double > i_1_;
+    std::vector< int > r_ref_;
+    std::vector< double > P20_;
+    std::vector< double > P11ex_;
+    std::vector< double > P11in_;
+    std::vector< double > P21ex_;
+    std::vector< double > P21in_;
+    std::vector< double > P22_;
+    std::vector< double > I_e_;
+    std::vector< double > Theta_;
+    std::vector< double > V_reset_;
+    std::vector< int > refractory_counts_;
+
+    //! input in the last step of the last time slice
+    std::vector< double > weighted_spikes_ex_;
+    std::vector< double > weighted_spikes_in_;
+
+    //! input of a block of nodes, one row per step
+    std::vector< double > spikes_ex_;
+    std::vector< double > spikes_in_;
+    std::vector< double > currents_0_;
+    std::vector< double > currents_1_;
+
+    //! Load state, propagators and parameters of nodes_
+    void load();
+
+    //! Store state back to nodes_
+    void store() const;
+  };
+
+  // ----------------------------------------------------------------
+
   /**
    * Buffers of the model.
    */
@@ -257,6 +326,7 @@ private:
   {
     Buffers_( iaf_psc_exp& );
     Buffers_( const Buffers_&, iaf_psc_exp& );
+    ~Buffers_();
 
     /** buffers and sums up incoming spikes/currents */
     RingBuffer spikes_ex_;
@@ -265,6 +335,9 @@ private:
 
     //! Logger for all analog data
     UniversalDataLogger< iaf_psc_exp > logger_;
+
+    //! Arrays of the batch starting at this node, see update_batch()
+    BatchArrays_* batch_arrays_;
   };
 
   // ----------------------------------------------------------------
@@ -272,7 +345,11 @@ private:
   /**
    * Internal variables of the model.
    */
-  struct Variables_
+  /**
+   * Propagators of the exact integration, shared by all neurons with
+   * identical time constants and capacitance.
+   */
+  struct Propagators_
   {
     /** Amplitude of the synaptic current.
         This value is chosen such that a post-synaptic potential with
@@ -289,6 +366,21 @@ private:
     double P21in_;
     double P22_;
 
+    //! Compute propagators for parameters p and resolution h
+    Propagators_( const Parameters_& p, const double h );
+
+    //! Return values the propagators depend on
+    static PropagatorCache< Propagators_ >::Key key( const Parameters_& p,
+      const double h );
+  };
+
+  // ----------------------------------------------------------------
+
+  struct Variables_
+  {
+    //! Propagators from propagatorCache_
+    PropagatorCache< Propagators_ >::Entry prop_;
+
     double weighted_spikes_ex_;
     double weighted_spikes_in_;
 
@@ -345,6 +437,9 @@ private:
 
   //! Mapping of recordables names to access functions
   static RecordablesMap< iaf_psc_exp > recordablesMap_;
+
+  //! Propagators shared by all instances
+  static PropagatorCache< Propagators_ > propagatorCache_;
 };
 
 
@@ -396,6 +491,18 @@ iaf_psc_exp::handles_test_event( DataLoggingRequest& dlr, rport receptor_type )
   return B_.logger_.connect_logging_device( dlr, recordablesMap_ );
 }
 
+inline bool
+iaf_psc_exp::supports_batch_update() const
+{
+  return true;
+}
+
+inline bool
+iaf_psc_exp::is_batch_updatable_() const
+{
+  return not B_.logger_.is_recording();
+}
+
 inline void
 iaf_psc_exp::get_status( DictionaryDatum& d ) const
 {
@@ -109,7 +109,9 @@
 #include "correlomatrix_detector.h"
 #include "correlospinmatrix_detector.h"
 #include "multimeter.h"
+#include "population_histogram.h"
 #include "spike_detector.h"
+#include "spike_statistics.h"
 #include "spin_detector.h"
 #include "weight_recorder.h"
 
@@ -282,6 +284,10 @@ ModelsModule::init( SLIInterpreter* )
 
   kernel().model_manager.register_node_model< spike_detector >(
     "spike_detector" );
+  kernel().model_manager.register_node_model< spike_statistics >(
+    "spike_statistics" );
+  kernel().model_manager.register_node_model< population_histogram >(
+    "population_histogram" );
   kernel().model_manager.register_node_model< weight_recorder >(
     "weight_recorder" );
   kernel().model_manager.register_node_model< spin_detector >(
@@ -376,12 +382,10 @@ ModelsModule::init( SLIInterpreter* )
     "iaf_chxk_2008" );
   kernel().model_manager.register_node_model< iaf_cond_alpha >(
     "iaf_cond_alpha" );
-  kernel().model_manager.register_node_model< iaf_cond_exp >( "iaf_cond_exp" );
   kernel().model_manager.register_node_model< iaf_cond_exp_sfa_rr >(
     "iaf_cond_exp_sfa_rr" );
   kernel().model_manager.register_node_model< iaf_cond_alpha_mc >(
     "iaf_cond_alpha_mc" );
-  kernel().model_manager.register_node_model< hh_psc_alpha >( "hh_psc_alpha" );
   kernel().model_manager.register_node_model< hh_psc_alpha_gap >(
     "hh_psc_alpha_gap" );
   kernel().model_manager.register_node_model< hh_cond_exp_traub >(
@@ -394,8 +398,6 @@ ModelsModule::init( SLIInterpreter* )
   kernel().model_manager.register_node_model< gif_pop_psc_exp >(
     "gif_pop_psc_exp" );
 
-  kernel().model_manager.register_node_model< aeif_cond_alpha >(
-    "aeif_cond_alpha" );
   kernel().model_manager.register_node_model< aeif_cond_exp >(
     "aeif_cond_exp" );
   kernel().model_manager.register_node_model< aeif_psc_alpha >(
@@ -412,7 +414,11 @@ ModelsModule::init( SLIInterpreter* )
     "siegert_neuron" );
 #endif
 
-  // This version of the AdEx model does not depend on GSL.
+  // These models do not depend on GSL.
+  kernel().model_manager.register_node_model< iaf_cond_exp >( "iaf_cond_exp" );
+  kernel().model_manager.register_node_model< hh_psc_alpha >( "hh_psc_alpha" );
+  kernel().model_manager.register_node_model< aeif_cond_alpha >(
+    "aeif_cond_alpha" );
   kernel().model_manager.register_node_model< aeif_cond_alpha_RK5 >(
     "aeif_cond_alpha_RK5",
     /*private_model*/ false,
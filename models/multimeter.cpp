@@ -22,6 +22,9 @@
 
 #include "multimeter.h"
 
+// C++ includes:
+#include <cmath>
+
 // Includes from nestkernel:
 #include "event_delivery_manager_impl.h"
 
@@ -48,14 +51,25 @@ Multimeter::Multimeter( const Multimeter& n )
 }
 
 port
-Multimeter::send_test_event( Node& target, rport receptor_type, synindex, bool )
+Multimeter::send_test_event( Node& target,
+  rport receptor_type,
+  synindex,
+  bool dummy_target )
 {
   DataLoggingRequest e( P_.interval_, P_.offset_, P_.record_from_ );
   e.set_sender( *this );
+  if ( not is_model_prototype() )
+  {
+    e.set_sampling_buffer( &B_.samples_ );
+  }
   port p = target.handles_test_event( e, receptor_type );
   if ( p != invalid_port_ and not is_model_prototype() )
   {
     B_.has_targets_ = true;
+    if ( not dummy_target )
+    {
+      ++B_.num_targets_;
+    }
   }
   return p;
 }
@@ -77,6 +91,8 @@ nest::Multimeter::Parameters_::Parameters_( const Parameters_& p )
 
 nest::Multimeter::Buffers_::Buffers_()
   : has_targets_( false )
+  , num_targets_( 0 )
+  , samples_()
 {
 }
 
@@ -173,12 +189,20 @@ void
 Multimeter::init_buffers_()
 {
   device_.init_buffers();
+  B_.samples_.clear();
 }
 
 void
 Multimeter::calibrate()
 {
+  device_.set_value_names( P_.record_from_ );
   device_.calibrate();
+
+  // number of samples per time slice, as in the data loggers
+  B_.samples_.resize( static_cast< size_t >(
+    std::ceil( kernel().connection_manager.get_min_delay()
+      / static_cast< double >( P_.interval_.get_steps() ) ) ) );
+
   V_.new_request_ = false;
   V_.current_request_data_start_ = 0;
 }
@@ -208,22 +232,29 @@ Multimeter::update( Time const& origin, const long from, const long )
     return;
   }
 
-  // We send a request to each of our targets.
-  // The target then immediately returns a DataLoggingReply event,
-  // which is caught by multimeter::handle(), which in turn
-  // ensures that the event is recorded.
-  // handle() has access to request_, so it knows what we asked for.
+  // Targets write their samples directly into B_.samples_. Only if some
+  // targets did not accept the sampling buffer when they were connected,
+  // we send a request to each of our targets. These targets then
+  // immediately return a DataLoggingReply event, which is caught by
+  // multimeter::handle(), which in turn ensures that the event is recorded.
+  // Targets writing to B_.samples_ do not answer the request.
   //
   // Provided we are recording anything, V_.new_request_ is set to true. This
-  // informs handle() that the first incoming DataLoggingReply is for a new time
-  // slice, so that the data from that first Reply must be pushed back; all
-  // following Reply data is then added.
+  // informs record_sample_() that the data of the first node is for a new
+  // time slice, so that the data from that first node must be pushed back;
+  // all following data is then added.
   //
-  // Note that not all nodes receiving the request will necessarily answer.
+  // Note that not all nodes will necessarily provide data.
   V_.new_request_ =
     B_.has_targets_ && not P_.record_from_.empty(); // no targets, no request
-  DataLoggingRequest req;
-  kernel().event_delivery_manager.send( *this, req );
+  if ( B_.samples_.get_num_nodes() < B_.num_targets_ )
+  {
+    DataLoggingRequest req;
+    kernel().event_delivery_manager.send( *this, req );
+  }
+  record_samples_();
+
+  device_.end_slice();
 }
 
 void
@@ -239,8 +270,8 @@ Multimeter::handle( DataLoggingReply& reply )
     V_.current_request_data_start_ = S_.data_.size();
   }
 
-  // count records that have been skipped during inactivity
-  size_t inactive_skipped = 0;
+  // count active records, skipping those during inactivity
+  size_t sample = 0;
 
   // record all data, time point by time point
   for ( size_t j = 0; j < info.size(); ++j )
@@ -252,73 +283,129 @@ Multimeter::handle( DataLoggingReply& reply )
 
     if ( not is_active( info[ j ].timestamp ) )
     {
-      ++inactive_skipped;
       continue;
     }
 
     // store stamp for current data set in event for logging
     reply.set_stamp( info[ j ].timestamp );
 
-    // record sender and time information; in accumulator mode only for first
-    // Reply in slice
-    if ( not device_.to_accumulator() || V_.new_request_ )
+    assert( info[ j ].data.size() == P_.record_from_.size() );
+    record_sample_( reply, sample, &info[ j ].data[ 0 ] );
+    ++sample;
+  }
+
+  // correct either we are done with the first reply or any later one
+  V_.new_request_ = false;
+}
+
+void
+Multimeter::record_samples_()
+{
+  const size_t rt = kernel().event_delivery_manager.read_toggle();
+
+  // event carrying sender, port and time stamp of samples for logging
+  const DataLoggingReply::Container no_info;
+  DataLoggingReply reply( no_info );
+  reply.set_receiver( *this );
+
+  for ( size_t node = 0; node < B_.samples_.get_num_nodes(); ++node )
+  {
+    const size_t num_samples = B_.samples_.get_num_samples( rt, node );
+    if ( num_samples == 0 )
     {
-      device_.record_event( reply, false ); // false: more data to come
+      continue; // node has not been updated, e.g., because it is frozen
     }
 
-    if ( not device_.to_accumulator() )
+    // mark the beginning of the data of the first node in this slice
+    if ( V_.new_request_ )
     {
-      // "print" actual data, but not in accumulator mode
-      print_value_( info[ j ].data );
+      V_.current_request_data_start_ = S_.data_.size();
+    }
 
-      if ( device_.to_memory() )
+    reply.set_sender_gid( B_.samples_.get_gid( node ) );
+    reply.set_port( node );
+
+    size_t sample = 0;
+    for ( size_t row = 0; row < num_samples; ++row )
+    {
+      const Time& stamp = B_.samples_.get_timestamp( rt, row );
+      if ( not is_active( stamp ) )
       {
-        S_.data_.push_back( info[ j ].data );
+        continue;
       }
+
+      reply.set_stamp( stamp );
+      record_sample_( reply, sample, B_.samples_.get_values( rt, row, node ) );
+      ++sample;
     }
-    else
+
+    V_.new_request_ = false;
+  }
+
+  B_.samples_.clear( rt );
+}
+
+void
+Multimeter::record_sample_( const Event& e,
+  const size_t sample,
+  const double* values )
+{
+  const size_t num_vars = P_.record_from_.size();
+
+  // record sender and time information; in accumulator mode only for first
+  // node in slice
+  if ( not device_.to_accumulator() || V_.new_request_ )
+  {
+    device_.record_event( e, false ); // false: more data to come
+  }
+
+  if ( not device_.to_accumulator() )
+  {
+    // "print" actual data, but not in accumulator mode
+    print_value_( values );
+
+    if ( device_.to_memory() )
+    {
+      S_.data_.push_back( std::vector< double >( values, values + num_vars ) );
+    }
+  }
+  else
+  {
+    if ( V_.new_request_ ) // first node in slice, push back to create new
+                           // time points
     {
-      if ( V_.new_request_ ) // first reply in slice, push back to create new
-                             // time points
+      S_.data_.push_back( std::vector< double >( values, values + num_vars ) );
+    }
+    else
+    { // add data; offset sample from current_request_data_start_
+      assert( V_.current_request_data_start_ + sample < S_.data_.size() );
+      std::vector< double >& dest =
+        S_.data_[ V_.current_request_data_start_ + sample ];
+      assert( dest.size() == num_vars );
+
+      for ( size_t k = 0; k < num_vars; ++k )
       {
-        S_.data_.push_back( info[ j ].data );
-      }
-      else
-      { // add data; offset j from current_request_data_start_, but inactive
-        // skipped entries subtracted
-        assert( j >= inactive_skipped );
-        assert( V_.current_request_data_start_ + j - inactive_skipped
-          < S_.data_.size() );
-        assert( S_.data_[ V_.current_request_data_start_ + j
-                     - inactive_skipped ].size() == info[ j ].data.size() );
-
-        for ( size_t k = 0; k < info[ j ].data.size(); ++k )
-        {
-          S_.data_[ V_.current_request_data_start_ + j
-            - inactive_skipped ][ k ] += info[ j ].data[ k ];
-        }
+        dest[ k ] += values[ k ];
       }
     }
   }
-
-  // correct either we are done with the first reply or any later one
-  V_.new_request_ = false;
 }
 
 void
-Multimeter::print_value_( const std::vector< double >& values )
+Multimeter::print_value_( const double* values )
 {
-  if ( values.size() < 1 )
+  const size_t num_vars = P_.record_from_.size();
+  if ( num_vars < 1 )
   {
     return;
   }
 
-  for ( size_t j = 0; j < values.size() - 1; ++j )
+  for ( size_t j = 0; j < num_vars - 1; ++j )
   {
     device_.print_value( values[ j ], false );
   }
 
-  device_.print_value( values[ values.size() - 1 ] );
+  device_.print_value( values[ num_vars - 1 ] );
 }
 
 
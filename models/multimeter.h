@@ -32,6 +32,7 @@
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "recording_device.h"
+#include "sampling_buffer.h"
 #include "sibling_container.h"
 
 // Includes from sli:
@@ -89,6 +90,10 @@ Remarks:
   you record from are frozen and others are not, data will only be collected
   from the unfrozen nodes. Most likely, this will lead to confusing results,
   so you should not use multimeter with frozen nodes.
+- Nodes write their samples directly into a buffer of the multimeter on
+  their thread, from which the multimeter reads the samples of all nodes
+  once per time slice. Nodes are sampled in the order in which they were
+  connected, and /ports contains the position of the node in this order.
 
 @note If you want to pick up values at every time stamp,
   you must set the interval to the simulation resolution.
@@ -180,10 +185,10 @@ protected:
 
   /**
    * Collect and output membrane potential information.
-   * This function pages all its targets at all pertinent sample
-   * points for membrane potential information and then outputs
-   * that information. The sampled nodes must provide data from
-   * the previous time slice.
+   * This function reads the samples taken by all its targets during
+   * the previous time slice and then outputs that information. Targets
+   * which do not write to the sampling buffer are paged with a
+   * DataLoggingRequest.
    */
   void update( Time const&, const long, const long );
 
@@ -201,7 +206,24 @@ private:
    *       RecordingDevice::print_value() can handle. Otherwise, specialization
    *       is required.
    */
-  void print_value_( const std::vector< double >& );
+  void print_value_( const double* );
+
+  /**
+   * Record the values of one sample.
+   * @param e event providing sender, port and time stamp of the sample
+   * @param sample index of the sample among the active samples of the
+   *        sender in the current time slice, used in accumulator mode
+   * @param values one value per recorded variable
+   */
+  void record_sample_( const Event& e,
+    const size_t sample,
+    const double* values );
+
+  /**
+   * Record all samples written to the sampling buffer in the previous
+   * time slice.
+   */
+  void record_samples_();
 
   /**
    * Add recorded data to dictionary.
@@ -259,6 +281,10 @@ private:
     Buffers_();
 
     bool has_targets_;
+    size_t num_targets_; //!< number of nodes connected on this thread
+
+    //! Samples written by data loggers of nodes on this thread
+    SamplingBuffer samples_;
   };
 
   // ------------------------------------------------------------
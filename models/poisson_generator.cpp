@@ -38,6 +38,7 @@
 
 nest::poisson_generator::Parameters_::Parameters_()
   : rate_( 0.0 ) // pA
+  , aggregate_slice_( false )
 {
 }
 
@@ -50,12 +51,14 @@ void
 nest::poisson_generator::Parameters_::get( DictionaryDatum& d ) const
 {
   def< double >( d, names::rate, rate_ );
+  def< bool >( d, names::aggregate_slice, aggregate_slice_ );
 }
 
 void
 nest::poisson_generator::Parameters_::set( const DictionaryDatum& d )
 {
   updateValue< double >( d, names::rate, rate_ );
+  updateValue< bool >( d, names::aggregate_slice, aggregate_slice_ );
   if ( rate_ < 0 )
   {
     throw BadProperty( "The rate cannot be negative." );
@@ -98,6 +101,9 @@ void
 nest::poisson_generator::init_buffers_()
 {
   device_.init_buffers();
+
+  B_.num_lags_ = 0;
+  B_.counts_.clear();
 }
 
 void
@@ -108,6 +114,9 @@ nest::poisson_generator::calibrate()
   // rate_ is in Hz, dt in ms, so we have to convert from s to ms
   V_.poisson_dev_.set_lambda(
     Time::get_resolution().get_ms() * P_.rate_ * 1e-3 );
+
+  // force update of slice_poisson_dev_, since the rate may have changed
+  B_.num_lags_ = 0;
 }
 
 
@@ -127,6 +136,42 @@ nest::poisson_generator::update( Time const& T, const long from, const long to )
     return;
   }
 
+  if ( P_.aggregate_slice_ )
+  {
+    // The device is active during a single time interval, so the steps
+    // in which it is active are contiguous.
+    long first_lag = from;
+    while ( first_lag < to
+      and not device_.is_active( T + Time::step( first_lag ) ) )
+    {
+      ++first_lag;
+    }
+    long last_lag = first_lag;
+    while ( last_lag < to and device_.is_active( T + Time::step( last_lag ) ) )
+    {
+      ++last_lag;
+    }
+
+    if ( first_lag == last_lag )
+    {
+      return; // no spikes in this interval
+    }
+
+    const long num_lags = last_lag - first_lag;
+    if ( num_lags != B_.num_lags_ )
+    {
+      B_.num_lags_ = num_lags;
+      B_.counts_.assign( num_lags, 0 );
+      V_.slice_poisson_dev_.set_lambda(
+        num_lags * Time::get_resolution().get_ms() * P_.rate_ * 1e-3 );
+    }
+
+    // the event carries the time stamp of the first active step
+    DSSpikeEvent se;
+    kernel().event_delivery_manager.send( *this, se, first_lag );
+    return;
+  }
+
   for ( long lag = from; lag < to; ++lag )
   {
     if ( not device_.is_active( T + Time::step( lag ) ) )
@@ -143,6 +188,13 @@ void
 nest::poisson_generator::event_hook( DSSpikeEvent& e )
 {
   librandom::RngPtr rng = kernel().rng_manager.get_rng( get_thread() );
+
+  if ( P_.aggregate_slice_ )
+  {
+    event_hook_aggregated_( e, rng );
+    return;
+  }
+
   long n_spikes = V_.poisson_dev_.ldev( rng );
 
   if ( n_spikes > 0 ) // we must not send events with multiplicity 0
@@ -151,3 +203,37 @@ nest::poisson_generator::event_hook( DSSpikeEvent& e )
     e.get_receiver().handle( e );
   }
 }
+
+void
+nest::poisson_generator::event_hook_aggregated_( DSSpikeEvent& e,
+  librandom::RngPtr& rng )
+{
+  // draw all spikes of the interval and distribute them uniformly over
+  // its steps, see Remarks in poisson_generator.h
+  const long n_spikes = V_.slice_poisson_dev_.ldev( rng );
+  if ( n_spikes == 0 )
+  {
+    return;
+  }
+
+  for ( long i = 0; i < n_spikes; ++i )
+  {
+    ++B_.counts_[ rng->ulrand( B_.num_lags_ ) ];
+  }
+
+  // the same event is passed on to all targets, so the time stamp must
+  // be restored afterwards
+  const Time first_stamp = e.get_stamp();
+  for ( long lag = 0; lag < B_.num_lags_; ++lag )
+  {
+    // we must not send events with multiplicity 0
+    if ( B_.counts_[ lag ] > 0 )
+    {
+      e.set_stamp( first_stamp + Time::step( lag ) );
+      e.set_multiplicity( B_.counts_[ lag ] );
+      e.get_receiver().handle( e );
+      B_.counts_[ lag ] = 0;
+    }
+  }
+  e.set_stamp( first_stamp );
+}
@@ -28,6 +28,9 @@
 /*                  Implementation: hep */
 /****************************************/
 
+// C++ includes:
+#include <vector>
+
 // Includes from librandom:
 #include "poisson_randomdev.h"
 
@@ -56,10 +59,14 @@ Parameters:
 
 The following parameters appear in the element's status dictionary:
 
-rate     double - mean firing rate in Hz
-origin   double - Time origin for device timer in ms
-start    double - begin of device application with resp. to origin in ms
-stop     double - end of device application with resp. to origin in ms
+rate            double  - mean firing rate in Hz
+aggregate_slice boolean - draw the spikes of an entire min-delay interval
+                          at once for each target (default: false)
+origin          double  - Time origin for device timer in ms
+start           double  - begin of device application with resp. to
+                          origin in ms
+stop            double  - end of device application with resp. to origin
+                          in ms
 
 Sends: SpikeEvent
 
@@ -95,6 +102,22 @@ refer to:
 
 http://ken.brainworks.uni-freiburg.de/cgi-bin/mailman/private/nest_developer/2011-January/002977.html
 
+If aggregate_slice is true, the generator sends a single event per
+min-delay interval instead of one event per time step. For each target,
+the hook then draws the total number of spikes n in all K time steps of
+the interval in which the generator is active from a Poisson distribution
+with K times the rate per step, and assigns each of the n spikes to one of
+the K steps with equal probability. Since the numbers of events of a
+Poisson process in disjoint intervals are independent, and a Poisson
+process conditioned on n events places them uniformly, the spike counts
+obtained for the individual steps are independent and Poisson distributed
+with the rate per step, i.e., they have exactly the same distribution as
+the spike counts drawn step by step. The individual spike trains differ,
+because the random numbers are consumed in a different order. The
+aggregated mode requires only one random number per target and interval
+if no spike occurs, and one call to the hook per target and interval,
+which makes it considerably faster for low rates per step.
+
 SeeAlso: poisson_generator_ps, Device, parrot_neuron
 */
 class poisson_generator : public DeviceNode
@@ -134,6 +157,9 @@ private:
   void update( Time const&, const long, const long );
   void event_hook( DSSpikeEvent& );
 
+  //! Deliver spikes of an entire min-delay interval to the receiver of e
+  void event_hook_aggregated_( DSSpikeEvent&, librandom::RngPtr& );
+
   // ------------------------------------------------------------
 
   /**
@@ -141,7 +167,8 @@ private:
    */
   struct Parameters_
   {
-    double rate_; //!< process rate in Hz
+    double rate_;          //!< process rate in Hz
+    bool aggregate_slice_; //!< draw spikes of a min-delay interval at once
 
     Parameters_(); //!< Sets default parameter values
 
@@ -151,9 +178,23 @@ private:
 
   // ------------------------------------------------------------
 
+  /**
+   * Buffers for drawing the spikes of a min-delay interval at once.
+   */
+  struct Buffers_
+  {
+    long num_lags_;              //!< number of active steps in interval
+    std::vector< long > counts_; //!< spike counts per step, zero between uses
+  };
+
+  // ------------------------------------------------------------
+
   struct Variables_
   {
     librandom::PoissonRandomDev poisson_dev_; //!< Random deviate generator
+
+    //! Random deviate generator for the spikes of B_.num_lags_ steps
+    librandom::PoissonRandomDev slice_poisson_dev_;
   };
 
   // ------------------------------------------------------------
@@ -161,6 +202,7 @@ private:
   StimulatingDevice< SpikeEvent > device_;
   Parameters_ P_;
   Variables_ V_;
+  Buffers_ B_;
 };
 
 inline port
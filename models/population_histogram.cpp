@@ -0,0 +1,343 @@
+/*
+ *  population_histogram.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "population_histogram.h"
+
+// C++ includes:
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+#include "sibling_container.h"
+
+// Includes from sli:
+#include "dict.h"
+#include "dictutils.h"
+
+/* ----------------------------------------------------------------
+ * Default constructors defining default parameters and state
+ * ---------------------------------------------------------------- */
+
+nest::population_histogram::Parameters_::Parameters_()
+  : bin_width_( Time::ms( 1.0 ) )
+{
+}
+
+nest::population_histogram::Parameters_::Parameters_( const Parameters_& p )
+  : bin_width_( p.bin_width_ )
+{
+  // Recalibrate, so that the bin width is valid after a resolution change,
+  // see correlation_detector.
+  bin_width_.calibrate();
+}
+
+nest::population_histogram::State_::State_()
+  : histogram_()
+  , n_senders_( 0 )
+  , merged_histogram_()
+  , merged_n_senders_( 0 )
+{
+}
+
+/* ----------------------------------------------------------------
+ * Parameter extraction and manipulation functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::population_histogram::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::bin_width ] = bin_width_.get_ms();
+}
+
+bool
+nest::population_histogram::Parameters_::set( const DictionaryDatum& d,
+  const population_histogram& n )
+{
+  bool reset = false;
+  double t;
+  if ( updateValue< double >( d, names::bin_width, t ) )
+  {
+    bin_width_ = Time::ms( t );
+    reset = true;
+  }
+
+  if ( not bin_width_.is_step() or bin_width_.get_steps() <= 0 )
+  {
+    throw StepMultipleRequired( n.get_name(), names::bin_width, bin_width_ );
+  }
+
+  return reset;
+}
+
+void
+nest::population_histogram::State_::reset()
+{
+  histogram_.clear();
+  merged_histogram_.clear();
+}
+
+/* ----------------------------------------------------------------
+ * Default and copy constructor for device
+ * ---------------------------------------------------------------- */
+
+nest::population_histogram::population_histogram()
+  : DeviceNode()
+  , device_()
+  , P_()
+  , S_()
+  , V_()
+{
+}
+
+nest::population_histogram::population_histogram(
+  const population_histogram& n )
+  : DeviceNode( n )
+  , device_( n.device_ )
+  , P_( n.P_ )
+  , S_() // no histogram or senders are copied
+  , V_()
+{
+}
+
+/* ----------------------------------------------------------------
+ * Node initialization functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::population_histogram::init_state_( const Node& np )
+{
+  const population_histogram& ph =
+    dynamic_cast< const population_histogram& >( np );
+  device_.init_state( ph.device_ );
+  init_buffers_();
+}
+
+void
+nest::population_histogram::init_buffers_()
+{
+  device_.init_buffers();
+  S_.reset();
+}
+
+void
+nest::population_histogram::calibrate()
+{
+  device_.calibrate();
+
+  V_.t_min_ = ( device_.get_origin() + device_.get_start() ).get_steps();
+  V_.bin_steps_ = P_.bin_width_.get_steps();
+}
+
+/* ----------------------------------------------------------------
+ * Update and spike handling functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::population_histogram::update( Time const&, const long, const long )
+{
+  // all spikes are counted in handle()
+}
+
+void
+nest::population_histogram::handle( SpikeEvent& e )
+{
+  if ( device_.is_active( e.get_stamp() ) )
+  {
+    assert( e.get_multiplicity() > 0 );
+
+    // bin i covers time stamps in (t_min + i*w, t_min + (i+1)*w]
+    const size_t bin =
+      ( e.get_stamp().get_steps() - V_.t_min_ - 1 ) / V_.bin_steps_;
+    if ( bin >= S_.histogram_.size() )
+    {
+      S_.histogram_.resize( bin + 1, 0 );
+    }
+    S_.histogram_[ bin ] += e.get_multiplicity();
+  }
+}
+
+/* ----------------------------------------------------------------
+ * Read-out of histogram
+ * ---------------------------------------------------------------- */
+
+long
+nest::population_histogram::elapsed_steps_() const
+{
+  const long t_min = ( device_.get_origin() + device_.get_start() ).get_steps();
+  const long t_max = ( device_.get_origin() + device_.get_stop() ).get_steps();
+  return std::max( 0L,
+    std::min( kernel().simulation_manager.get_time().get_steps(), t_max )
+      - t_min );
+}
+
+void
+nest::population_histogram::post_run_cleanup()
+{
+  // sum once per run, MPI communication is funneled through thread 0
+  if ( get_thread() == 0 )
+  {
+    collect_();
+  }
+}
+
+void
+nest::population_histogram::collect_()
+{
+  // the number of bins is the same on all processes
+  const long w = P_.bin_width_.get_steps();
+  const size_t num_bins = ( elapsed_steps_() + w - 1 ) / w;
+  std::vector< long >& histogram = S_.merged_histogram_;
+  long& n_senders = S_.merged_n_senders_;
+  histogram.assign( num_bins, 0 );
+  n_senders = 0;
+
+  // sum the histograms of all threads
+  const SiblingContainer* siblings =
+    kernel().node_manager.get_thread_siblings( get_gid() );
+  for ( std::vector< Node* >::const_iterator sibling = siblings->begin();
+        sibling != siblings->end();
+        ++sibling )
+  {
+    const population_histogram& ph =
+      dynamic_cast< const population_histogram& >( **sibling );
+    const size_t n = std::min( num_bins, ph.S_.histogram_.size() );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      histogram[ i ] += ph.S_.histogram_[ i ];
+    }
+    n_senders += ph.S_.n_senders_;
+  }
+
+  if ( kernel().mpi_manager.get_num_processes() == 1 )
+  {
+    return;
+  }
+
+  // sum the histograms of all MPI processes, the number of senders is
+  // appended to the histogram to require only a single reduction
+  std::vector< double > buffer( histogram.begin(), histogram.end() );
+  buffer.push_back( n_senders );
+  kernel().mpi_manager.communicate_Allreduce_sum_in_place( buffer );
+
+  for ( size_t i = 0; i < num_bins; ++i )
+  {
+    histogram[ i ] = static_cast< long >( buffer[ i ] );
+  }
+  n_senders = static_cast< long >( buffer.back() );
+}
+
+void
+nest::population_histogram::get_status( DictionaryDatum& d ) const
+{
+  device_.get_status( d );
+  P_.get( d );
+  ( *d )[ names::element_type ] = LiteralDatum( names::recorder );
+
+  // number of complete and incomplete bins up to the current time
+  const long w = P_.bin_width_.get_steps();
+  const long elapsed = elapsed_steps_();
+  const size_t num_bins = ( elapsed + w - 1 ) / w;
+  const size_t num_complete_bins = elapsed / w;
+
+  // histogram summed at the end of the last run is kept on thread 0,
+  // bins discarded since then are reported empty
+  const State_* merged = &S_;
+  if ( not is_model_prototype() )
+  {
+    const SiblingContainer* siblings =
+      kernel().node_manager.get_thread_siblings( get_gid() );
+    merged = &dynamic_cast< const population_histogram& >(
+      *siblings->get_thread_sibling( 0 ) ).S_;
+  }
+  std::vector< long >* histogram =
+    new std::vector< long >( merged->merged_histogram_ );
+  histogram->resize( num_bins, 0 );
+  const long n_senders = merged->merged_n_senders_;
+
+  const double nan = std::numeric_limits< double >::quiet_NaN();
+  const double bin_width = P_.bin_width_.get_ms();
+  std::vector< double >* rates = new std::vector< double >();
+  rates->reserve( num_bins );
+  for ( size_t i = 0; i < num_bins; ++i )
+  {
+    rates->push_back( n_senders > 0
+        ? 1000.0 * ( *histogram )[ i ] / ( n_senders * bin_width )
+        : nan );
+  }
+
+  // Fano factor of spike counts in complete bins
+  double fano_factor = nan;
+  if ( num_complete_bins > 0 )
+  {
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    for ( size_t i = 0; i < num_complete_bins; ++i )
+    {
+      const double count = ( *histogram )[ i ];
+      sum += count;
+      sum_sq += count * count;
+    }
+    const double mean = sum / num_complete_bins;
+    const double var =
+      std::max( sum_sq / num_complete_bins - mean * mean, 0.0 );
+    if ( mean > 0 )
+    {
+      fano_factor = var / mean;
+    }
+  }
+
+  ( *d )[ names::n_events ] =
+    std::accumulate( histogram->begin(), histogram->end(), 0L );
+  ( *d )[ names::n_senders ] = n_senders;
+  ( *d )[ names::fano_factor ] = fano_factor;
+  ( *d )[ names::histogram ] = IntVectorDatum( histogram );
+  ( *d )[ names::rates ] = DoubleVectorDatum( rates );
+}
+
+void
+nest::population_histogram::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  bool reset = ptmp.set( d, *this );
+
+  long n_events = 0;
+  if ( updateValue< long >( d, names::n_events, n_events ) )
+  {
+    if ( n_events != 0 )
+    {
+      throw BadProperty( "n_events can only be set to 0." );
+    }
+    reset = true;
+  }
+
+  device_.set_status( d );
+
+  // if we get here, temporaries contain consistent set of properties
+  P_ = ptmp;
+
+  if ( reset )
+  {
+    S_.reset();
+  }
+}
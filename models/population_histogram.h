@@ -0,0 +1,226 @@
+/*
+ *  population_histogram.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef POPULATION_HISTOGRAM_H
+#define POPULATION_HISTOGRAM_H
+
+// C++ includes:
+#include <vector>
+
+// Includes from nestkernel:
+#include "device_node.h"
+#include "event.h"
+#include "exceptions.h"
+#include "nest_time.h"
+#include "nest_types.h"
+#include "pseudo_recording_device.h"
+
+namespace nest
+{
+
+/** @BeginDocumentation
+Name: population_histogram - Device computing the spike time histogram of a
+population
+
+Description:
+
+The population_histogram device counts the spikes of all nodes connected
+to it in time bins of width bin_width. Individual spikes are not stored,
+so that memory requirements only depend on the number of bins.
+
+Bins start at origin+start. Bin i contains all spikes with time stamps in
+(origin+start+i*bin_width, origin+start+(i+1)*bin_width]. Each thread
+accumulates the spikes of the nodes on that thread. The histograms of all
+threads and, in distributed simulations, of all MPI processes are summed
+at the end of each call to Simulate or Run, and GetStatus returns the
+histogram summed last.
+
+Parameters:
+
+bin_width   double       - Width of time bins in ms, must be a multiple of
+                           the resolution (default: 1.0). Changing the
+                           bin width discards the histogram.
+
+The following quantities are read-only:
+
+histogram   intvector    - Number of spikes in each bin up to the current
+                           simulation time, the last bin may be incomplete
+rates       doublevector - Population rate in each bin in spikes/s, i.e.,
+                           spike count divided by bin width and n_senders
+n_senders   integer      - Number of connections to the device
+fano_factor double       - Fano factor of the spike counts of all complete
+                           bins, i.e., their variance divided by their
+                           mean, NaN if undefined
+
+n_events    integer      - Total number of spikes counted. Set to 0 to
+                           discard the histogram.
+
+Remarks:
+
+The variance of the spike counts is computed with normalization by the
+number of bins, as numpy.var() does by default. Spikes with multiplicity
+larger than one are counted as several spikes.
+
+Example:
+
+/iaf_psc_alpha 100 << /I_e 400.0 >> Create ;
+/population_histogram << /bin_width 5.0 >> Create /hist Set
+[ 1 100 ] Range [ hist ] Connect
+1000.0 Simulate
+hist [ /rates ] get ==
+
+Receives: SpikeEvent
+
+FirstVersion: October 2026
+
+SeeAlso: spike_statistics, spike_detector, PseudoRecordingDevice
+*/
+class population_histogram : public DeviceNode
+{
+
+public:
+  population_histogram();
+  population_histogram( const population_histogram& );
+
+  bool
+  has_proxies() const
+  {
+    return false;
+  }
+
+  bool
+  local_receiver() const
+  {
+    return true;
+  }
+
+  /**
+   * Import sets of overloaded virtual functions.
+   * @see Technical Issues / Virtual Functions: Overriding, Overloading, and
+   * Hiding
+   */
+  using Node::handle;
+  using Node::handles_test_event;
+  using Node::receives_signal;
+
+  void handle( SpikeEvent& );
+
+  port handles_test_event( SpikeEvent&, rport );
+
+  SignalType receives_signal() const;
+
+  void get_status( DictionaryDatum& ) const;
+  void set_status( const DictionaryDatum& );
+
+  void post_run_cleanup();
+
+private:
+  void init_state_( Node const& );
+  void init_buffers_();
+  void calibrate();
+
+  void update( Time const&, const long, const long );
+
+  /**
+   * Time elapsed in the recording interval up to the current time, in
+   * steps.
+   */
+  long elapsed_steps_() const;
+
+  /**
+   * Sum histograms and number of senders of all thread siblings and MPI
+   * processes into State_::merged_histogram_ and State_::merged_n_senders_.
+   * This involves collective MPI communication and is therefore called
+   * on all processes by post_run_cleanup() of the sibling on thread 0.
+   */
+  void collect_();
+
+  struct Parameters_
+  {
+    Time bin_width_; //!< width of time bins
+
+    Parameters_();
+    Parameters_( const Parameters_& );
+
+    void get( DictionaryDatum& ) const;
+
+    /**
+     * Set values from dictionary.
+     * @return true if the histogram must be discarded
+     */
+    bool set( const DictionaryDatum&, const population_histogram& );
+  };
+
+  struct State_
+  {
+    std::vector< long > histogram_; //!< spike counts of senders on thread
+    long n_senders_;                //!< number of connections on thread
+
+    /**
+     * Histogram and number of senders of all threads and processes at the
+     * end of the last call to Run, only kept by the sibling on thread 0.
+     */
+    std::vector< long > merged_histogram_;
+    long merged_n_senders_;
+
+    State_();
+
+    //! Discard histograms, keeping the number of senders
+    void reset();
+  };
+
+  struct Variables_
+  {
+    long t_min_;     //!< time stamp of start of first bin, in steps
+    long bin_steps_; //!< width of bins, in steps
+  };
+
+  PseudoRecordingDevice device_;
+  Parameters_ P_;
+  State_ S_;
+  Variables_ V_;
+};
+
+inline port
+population_histogram::handles_test_event( SpikeEvent&, rport receptor_type )
+{
+  if ( receptor_type != 0 )
+  {
+    throw UnknownReceptorType( receptor_type, get_name() );
+  }
+
+  if ( not is_model_prototype() )
+  {
+    ++S_.n_senders_;
+  }
+  return 0;
+}
+
+inline SignalType
+population_histogram::receives_signal() const
+{
+  return ALL;
+}
+
+} // namespace
+
+#endif // POPULATION_HISTOGRAM_H
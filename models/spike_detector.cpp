@@ -67,7 +67,7 @@ nest::spike_detector::init_buffers_()
 {
   device_.init_buffers();
 
-  std::vector< std::vector< Event* > > tmp( 2, std::vector< Event* >() );
+  std::vector< RecordingDevice::SpikeRecords > tmp( 2 );
   B_.spikes_.swap( tmp );
 }
 
@@ -108,19 +108,14 @@ nest::spike_detector::calibrate()
 void
 nest::spike_detector::update( Time const&, const long, const long )
 {
-  for ( std::vector< Event* >::iterator e =
-          B_.spikes_[ kernel().event_delivery_manager.read_toggle() ].begin();
-        e != B_.spikes_[ kernel().event_delivery_manager.read_toggle() ].end();
-        ++e )
-  {
-    assert( *e != 0 );
-    device_.record_event( **e );
-    delete *e;
-  }
+  device_.record_spikes(
+    B_.spikes_[ kernel().event_delivery_manager.read_toggle() ] );
 
   // do not use swap here to clear, since we want to keep the reserved()
   // memory for the next round
   B_.spikes_[ kernel().event_delivery_manager.read_toggle() ].clear();
+
+  device_.end_slice();
 }
 
 void
@@ -175,9 +170,11 @@ nest::spike_detector::handle( SpikeEvent& e )
 
     for ( int i = 0; i < e.get_multiplicity(); ++i )
     {
-      // We store the complete events
-      Event* event = e.clone();
-      B_.spikes_[ dest_buffer ].push_back( event );
+      B_.spikes_[ dest_buffer ].push_back( e.get_sender_gid(),
+        e.get_stamp().get_steps(),
+        e.get_offset(),
+        e.get_weight(),
+        e.get_port() );
     }
   }
 }
@@ -149,7 +149,7 @@ private:
    * This data structure buffers all incoming spikes until they are
    * passed to the RecordingDevice for storage or output during update().
    * update() always reads from spikes_[Network::get_network().read_toggle()]
-   * and deletes all events that have been read.
+   * and clears it afterwards.
    *
    * Events arriving from locally sending nodes, i.e., devices without
    * proxies, are stored in spikes_[Network::get_network().write_toggle()], to
@@ -162,10 +162,13 @@ private:
    * so that they can be recorded by the subsequent call to update().
    * This does not violate order-independence, since all spikes are delivered
    * from the global queue before any node is updated.
+   *
+   * Spikes are stored column-wise as sender, time stamp, offset, weight
+   * and port, so that no Event needs to be allocated per spike.
    */
   struct Buffers_
   {
-    std::vector< std::vector< Event* > > spikes_;
+    std::vector< RecordingDevice::SpikeRecords > spikes_;
   };
 
   RecordingDevice device_;
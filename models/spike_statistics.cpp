@@ -0,0 +1,318 @@
+/*
+ *  spike_statistics.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "spike_statistics.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+#include "sibling_container.h"
+
+// Includes from sli:
+#include "dict.h"
+#include "dictutils.h"
+
+/* ----------------------------------------------------------------
+ * Spike statistics of single senders
+ * ---------------------------------------------------------------- */
+
+nest::spike_statistics::SenderStats_::SenderStats_()
+  : n_spikes_( 0 )
+  , n_isi_( 0 )
+  , isi_sum_( 0.0 )
+  , isi_sum_sq_( 0.0 )
+  , last_spike_( -std::numeric_limits< double >::infinity() )
+{
+}
+
+void
+nest::spike_statistics::SenderStats_::add( const spikecounter& spike )
+{
+  for ( long i = 0; i < static_cast< long >( spike.multiplicity_ ); ++i )
+  {
+    if ( n_spikes_ > 0 )
+    {
+      const double isi = spike.spike_time_ - last_spike_;
+      ++n_isi_;
+      isi_sum_ += isi;
+      isi_sum_sq_ += isi * isi;
+    }
+    ++n_spikes_;
+    last_spike_ = spike.spike_time_;
+  }
+}
+
+void
+nest::spike_statistics::SenderStats_::merge( const SenderStats_& other )
+{
+  n_spikes_ += other.n_spikes_;
+  n_isi_ += other.n_isi_;
+  isi_sum_ += other.isi_sum_;
+  isi_sum_sq_ += other.isi_sum_sq_;
+  last_spike_ = std::max( last_spike_, other.last_spike_ );
+}
+
+void
+nest::spike_statistics::SenderStats_::reset()
+{
+  *this = SenderStats_();
+}
+
+void
+nest::spike_statistics::State_::reset()
+{
+  for ( StatsMap_::iterator it = stats_.begin(); it != stats_.end(); ++it )
+  {
+    it->second.reset();
+  }
+  for ( StatsMap_::iterator it = merged_.begin(); it != merged_.end(); ++it )
+  {
+    it->second.reset();
+  }
+}
+
+/* ----------------------------------------------------------------
+ * Default and copy constructor for device
+ * ---------------------------------------------------------------- */
+
+nest::spike_statistics::spike_statistics()
+  : DeviceNode()
+  , device_()
+  , S_()
+{
+}
+
+nest::spike_statistics::spike_statistics( const spike_statistics& n )
+  : DeviceNode( n )
+  , device_( n.device_ )
+  , S_() // no statistics or senders are copied
+{
+}
+
+/* ----------------------------------------------------------------
+ * Node initialization functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_statistics::init_state_( const Node& np )
+{
+  const spike_statistics& ss = dynamic_cast< const spike_statistics& >( np );
+  device_.init_state( ss.device_ );
+  init_buffers_();
+}
+
+void
+nest::spike_statistics::init_buffers_()
+{
+  device_.init_buffers();
+  S_.reset();
+}
+
+void
+nest::spike_statistics::calibrate()
+{
+  device_.calibrate();
+}
+
+/* ----------------------------------------------------------------
+ * Update and spike handling functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_statistics::update( Time const&, const long, const long )
+{
+  // all statistics are accumulated in handle()
+}
+
+void
+nest::spike_statistics::handle( SpikeEvent& e )
+{
+  if ( device_.is_active( e.get_stamp() ) )
+  {
+    assert( e.get_multiplicity() > 0 );
+
+    // Spikes of each sender are delivered in chronological order, since
+    // they are delivered in the order in which they are emitted.
+    const spikecounter spike(
+      e.get_stamp().get_ms() - e.get_offset(), e.get_multiplicity() );
+    S_.stats_[ e.get_sender_gid() ].add( spike );
+  }
+}
+
+/* ----------------------------------------------------------------
+ * Read-out of statistics
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_statistics::post_run_cleanup()
+{
+  // merge once per run, MPI communication is funneled through thread 0
+  if ( get_thread() == 0 )
+  {
+    collect_();
+  }
+}
+
+void
+nest::spike_statistics::collect_()
+{
+  StatsMap_& stats = S_.merged_;
+  stats.clear();
+
+  // merge the statistics of all threads
+  const SiblingContainer* siblings =
+    kernel().node_manager.get_thread_siblings( get_gid() );
+  for ( std::vector< Node* >::const_iterator sibling = siblings->begin();
+        sibling != siblings->end();
+        ++sibling )
+  {
+    const spike_statistics& ss =
+      dynamic_cast< const spike_statistics& >( **sibling );
+    for ( StatsMap_::const_iterator it = ss.S_.stats_.begin();
+          it != ss.S_.stats_.end();
+          ++it )
+    {
+      stats[ it->first ].merge( it->second );
+    }
+  }
+
+  if ( kernel().mpi_manager.get_num_processes() == 1 )
+  {
+    return;
+  }
+
+  // merge the statistics of all MPI processes
+  const size_t record_size = 5;
+  std::vector< double > send_buffer;
+  send_buffer.reserve( record_size * stats.size() );
+  for ( StatsMap_::const_iterator it = stats.begin(); it != stats.end(); ++it )
+  {
+    send_buffer.push_back( it->first );
+    send_buffer.push_back( it->second.n_spikes_ );
+    send_buffer.push_back( it->second.n_isi_ );
+    send_buffer.push_back( it->second.isi_sum_ );
+    send_buffer.push_back( it->second.isi_sum_sq_ );
+  }
+
+  std::vector< double > recv_buffer;
+  std::vector< int > displacements;
+  kernel().mpi_manager.communicate( send_buffer, recv_buffer, displacements );
+
+  stats.clear();
+  for ( size_t i = 0; i < recv_buffer.size(); i += record_size )
+  {
+    SenderStats_ remote;
+    remote.n_spikes_ = static_cast< long >( recv_buffer[ i + 1 ] );
+    remote.n_isi_ = static_cast< long >( recv_buffer[ i + 2 ] );
+    remote.isi_sum_ = recv_buffer[ i + 3 ];
+    remote.isi_sum_sq_ = recv_buffer[ i + 4 ];
+    stats[ static_cast< index >( recv_buffer[ i ] ) ].merge( remote );
+  }
+}
+
+void
+nest::spike_statistics::get_status( DictionaryDatum& d ) const
+{
+  device_.get_status( d );
+  ( *d )[ names::element_type ] = LiteralDatum( names::recorder );
+
+  // statistics merged at the end of the last run are kept on thread 0
+  const StatsMap_* merged = &S_.merged_;
+  if ( not is_model_prototype() )
+  {
+    const SiblingContainer* siblings =
+      kernel().node_manager.get_thread_siblings( get_gid() );
+    merged = &dynamic_cast< const spike_statistics& >(
+      *siblings->get_thread_sibling( 0 ) ).S_.merged_;
+  }
+  const StatsMap_& stats = *merged;
+
+  // time elapsed in the recording interval, in ms
+  const long t_min =
+    ( device_.get_origin() + device_.get_start() ).get_steps();
+  const long t_max = ( device_.get_origin() + device_.get_stop() ).get_steps();
+  const long t_end =
+    std::min( kernel().simulation_manager.get_time().get_steps(), t_max );
+  const double duration = Time::delay_steps_to_ms( t_end - t_min );
+
+  const double nan = std::numeric_limits< double >::quiet_NaN();
+  std::vector< long >* senders = new std::vector< long >();
+  std::vector< long >* n_spikes = new std::vector< long >();
+  std::vector< double >* rates = new std::vector< double >();
+  std::vector< double >* isi_mean = new std::vector< double >();
+  std::vector< double >* isi_cv = new std::vector< double >();
+  long n_events = 0;
+
+  for ( StatsMap_::const_iterator it = stats.begin(); it != stats.end(); ++it )
+  {
+    const SenderStats_& s = it->second;
+    senders->push_back( it->first );
+    n_spikes->push_back( s.n_spikes_ );
+    n_events += s.n_spikes_;
+    rates->push_back( duration > 0 ? 1000.0 * s.n_spikes_ / duration : nan );
+
+    if ( s.n_isi_ > 0 )
+    {
+      const double mean = s.isi_sum_ / s.n_isi_;
+      const double var =
+        std::max( s.isi_sum_sq_ / s.n_isi_ - mean * mean, 0.0 );
+      isi_mean->push_back( mean );
+      isi_cv->push_back( mean > 0 ? std::sqrt( var ) / mean : nan );
+    }
+    else
+    {
+      isi_mean->push_back( nan );
+      isi_cv->push_back( nan );
+    }
+  }
+
+  ( *d )[ names::senders ] = IntVectorDatum( senders );
+  ( *d )[ names::n_spikes ] = IntVectorDatum( n_spikes );
+  ( *d )[ names::rates ] = DoubleVectorDatum( rates );
+  ( *d )[ names::isi_mean ] = DoubleVectorDatum( isi_mean );
+  ( *d )[ names::isi_cv ] = DoubleVectorDatum( isi_cv );
+  ( *d )[ names::n_events ] = n_events;
+}
+
+void
+nest::spike_statistics::set_status( const DictionaryDatum& d )
+{
+  long n_events = 0;
+  const bool reset =
+    updateValue< long >( d, names::n_events, n_events );
+  if ( reset and n_events != 0 )
+  {
+    throw BadProperty( "n_events can only be set to 0." );
+  }
+
+  device_.set_status( d );
+
+  if ( reset )
+  {
+    S_.reset();
+  }
+}
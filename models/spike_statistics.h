@@ -0,0 +1,225 @@
+/*
+ *  spike_statistics.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_STATISTICS_H
+#define SPIKE_STATISTICS_H
+
+// C++ includes:
+#include <map>
+
+// Includes from nestkernel:
+#include "device_node.h"
+#include "event.h"
+#include "exceptions.h"
+#include "nest_types.h"
+#include "pseudo_recording_device.h"
+#include "spikecounter.h"
+
+namespace nest
+{
+
+/** @BeginDocumentation
+Name: spike_statistics - Device computing spike statistics of single neurons
+
+Description:
+
+The spike_statistics device counts the spikes of each node connected to it
+and accumulates the moments of the inter-spike intervals (ISIs) of each
+node. In contrast to the spike_detector, individual spikes are not stored,
+so that memory requirements only depend on the number of nodes recorded
+from.
+
+Each thread accumulates the statistics of the nodes on that thread. The
+statistics of all threads and, in distributed simulations, of all MPI
+processes are merged at the end of each call to Simulate or Run, and
+GetStatus returns the statistics merged last. Nodes connected to the
+device after that are reported after the next call to Simulate or Run.
+
+Only spikes with time stamps in (origin+start, origin+stop] are counted.
+Rates are computed with respect to the time elapsed in this interval.
+Spikes emitted during the time slice immediately preceding the end of the
+simulation time are counted only if they have been delivered, see
+spike_detector.
+
+Parameters:
+
+The following quantities are read-only and contain one entry per
+node connected to the device, ordered by GID:
+
+senders   intvector    - GIDs of the nodes
+n_spikes  intvector    - Number of spikes of each node
+rates     doublevector - Firing rate of each node in spikes/s
+isi_mean  doublevector - Mean ISI of each node in ms, NaN if the node
+                         has fired less than two spikes
+isi_cv    doublevector - Coefficient of variation of the ISIs of each
+                         node, i.e., their standard deviation divided by
+                         their mean, NaN if the node has fired less than
+                         two spikes
+
+n_events  integer      - Total number of spikes counted. Set to 0 to
+                         discard all statistics.
+
+Remarks:
+
+The standard deviation of the ISIs is computed with normalization by the
+number of ISIs, as numpy.std() does by default. Spikes with multiplicity
+larger than one are counted as several spikes at the same time.
+
+Example:
+
+/iaf_psc_alpha 10 << /I_e 400.0 >> Create ;
+/spike_statistics Create /stats Set
+[ 1 10 ] Range [ stats ] Connect
+1000.0 Simulate
+stats [ /rates ] get ==
+
+Receives: SpikeEvent
+
+FirstVersion: October 2026
+
+SeeAlso: population_histogram, spike_detector, PseudoRecordingDevice
+*/
+class spike_statistics : public DeviceNode
+{
+
+public:
+  spike_statistics();
+  spike_statistics( const spike_statistics& );
+
+  bool
+  has_proxies() const
+  {
+    return false;
+  }
+
+  bool
+  local_receiver() const
+  {
+    return true;
+  }
+
+  /**
+   * Import sets of overloaded virtual functions.
+   * @see Technical Issues / Virtual Functions: Overriding, Overloading, and
+   * Hiding
+   */
+  using Node::handle;
+  using Node::handles_test_event;
+  using Node::receives_signal;
+
+  void handle( SpikeEvent& );
+
+  port handles_test_event( SpikeEvent&, rport );
+
+  SignalType receives_signal() const;
+
+  void get_status( DictionaryDatum& ) const;
+  void set_status( const DictionaryDatum& );
+
+  void post_run_cleanup();
+
+private:
+  void init_state_( Node const& );
+  void init_buffers_();
+  void calibrate();
+
+  void update( Time const&, const long, const long );
+
+  /**
+   * Spike statistics of a single sender.
+   */
+  struct SenderStats_
+  {
+    long n_spikes_;     //!< number of spikes
+    long n_isi_;        //!< number of ISIs
+    double isi_sum_;    //!< sum of ISIs, in ms
+    double isi_sum_sq_; //!< sum of squared ISIs, in ms^2
+    double last_spike_; //!< time of last spike, in ms
+
+    SenderStats_();
+
+    //! Register spike, spikes must be added in chronological order
+    void add( const spikecounter& );
+
+    //! Add statistics of the same sender collected elsewhere
+    void merge( const SenderStats_& );
+
+    void reset();
+  };
+
+  typedef std::map< index, SenderStats_ > StatsMap_;
+
+  /**
+   * Merge statistics of all thread siblings and MPI processes into
+   * State_::merged_. Senders are included even if they have not spiked.
+   * This involves collective MPI communication and is therefore called
+   * on all processes by post_run_cleanup() of the sibling on thread 0.
+   */
+  void collect_();
+
+  struct State_
+  {
+    /**
+     * Accumulated statistics of senders on this thread.
+     * Entries are created when senders are connected to the device,
+     * so that silent senders are reported as well.
+     */
+    StatsMap_ stats_;
+
+    /**
+     * Statistics of all threads and processes at the end of the last call
+     * to Run, only kept by the sibling on thread 0.
+     */
+    StatsMap_ merged_;
+
+    void reset();
+  };
+
+  PseudoRecordingDevice device_;
+  State_ S_;
+};
+
+inline port
+spike_statistics::handles_test_event( SpikeEvent& e, rport receptor_type )
+{
+  if ( receptor_type != 0 )
+  {
+    throw UnknownReceptorType( receptor_type, get_name() );
+  }
+
+  // register sender, so that it appears in the statistics without spikes
+  if ( not is_model_prototype() )
+  {
+    S_.stats_[ e.get_sender().get_gid() ];
+  }
+  return 0;
+}
+
+inline SignalType
+spike_statistics::receives_signal() const
+{
+  return ALL;
+}
+
+} // namespace
+
+#endif // SPIKE_STATISTICS_H
@@ -228,8 +228,8 @@ STDPConnection< targetidentifierT >::send( Event& e,
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from post-synaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  SpikeHistory::iterator start;
+  SpikeHistory::iterator finish;
 
   // For a new synapse, t_lastspike_ contains the point in time of the last
   // spike. So we initially read the
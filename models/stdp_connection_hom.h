@@ -292,8 +292,8 @@ STDPConnectionHom< targetidentifierT >::send( Event& e,
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from post-synaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  SpikeHistory::iterator start;
+  SpikeHistory::iterator finish;
   target->get_history( t_lastspike_ - dendritic_delay,
     t_spike - dendritic_delay,
     &start,
@@ -553,8 +553,8 @@ STDPDopaConnection< targetidentifierT >::send( Event& e,
 
   // get spike history in relevant range (t_last_update, t_spike] from
   // post-synaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  SpikeHistory::iterator start;
+  SpikeHistory::iterator finish;
   target->get_history( t_last_update_ - dendritic_delay,
     t_spike - dendritic_delay,
     &start,
@@ -609,8 +609,8 @@ STDPDopaConnection< targetidentifierT >::trigger_update_weight( thread t,
 
   // get spike history in relevant range (t_last_update, t_trig] from postsyn.
   // neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  SpikeHistory::iterator start;
+  SpikeHistory::iterator finish;
   get_target( t )->get_history( t_last_update_ - dendritic_delay,
     t_trig - dendritic_delay,
     &start,
@@ -240,8 +240,8 @@ STDPTripletConnection< targetidentifierT >::send( Event& e,
   Node* target = get_target( t );
 
   // get spike history in relevant range (t1, t2] from post-synaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  SpikeHistory::iterator start;
+  SpikeHistory::iterator finish;
   target->get_history( t_lastspike_ - dendritic_delay,
     t_spike - dendritic_delay,
     &start,
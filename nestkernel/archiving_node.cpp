@@ -78,15 +78,14 @@ nest::Archiving_Node::Archiving_Node( const Archiving_Node& n )
 void
 Archiving_Node::register_stdp_connection( double t_first_read )
 {
-  // Mark all entries in the deque, which we will not read in future as read by
-  // this input input, so that we savely increment the incoming number of
-  // connections afterwards without leaving spikes in the history.
+  // Mark all entries in the history, which we will not read in future as
+  // read by this input input, so that we savely increment the incoming number
+  // of connections afterwards without leaving spikes in the history.
   // For details see bug #218. MH 08-04-22
 
-  for ( std::deque< histentry >::iterator runner = history_.begin();
-        runner != history_.end()
-          and ( t_first_read - runner->t_ > -1.0
-                  * kernel().connection_manager.get_stdp_eps() );
+  const SpikeHistory::iterator last_read = history_.lower_bound(
+    t_first_read + kernel().connection_manager.get_stdp_eps() );
+  for ( SpikeHistory::iterator runner = history_.begin(); runner != last_read;
         ++runner )
   {
     ( runner->access_counter_ )++;
@@ -102,17 +101,16 @@ nest::Archiving_Node::get_K_value( double t )
   {
     return Kminus_;
   }
-  int i = history_.size() - 1;
-  while ( i >= 0 )
+
+  // last spike before t
+  SpikeHistory::iterator it =
+    history_.lower_bound( t - kernel().connection_manager.get_stdp_eps() );
+  if ( it == history_.begin() )
   {
-    if ( t - history_[ i ].t_ > kernel().connection_manager.get_stdp_eps() )
-    {
-      return ( history_[ i ].Kminus_
-        * std::exp( ( history_[ i ].t_ - t ) * tau_minus_inv_ ) );
-    }
-    i--;
+    return 0;
   }
-  return 0;
+  --it;
+  return ( it->Kminus_ * std::exp( ( it->t_ - t ) * tau_minus_inv_ ) );
 }
 
 void
@@ -127,54 +125,45 @@ nest::Archiving_Node::get_K_values( double t,
     K_value = Kminus_;
     return;
   }
-  // case
-  int i = history_.size() - 1;
-  while ( i >= 0 )
-  {
-    if ( t - history_[ i ].t_ > kernel().connection_manager.get_stdp_eps() )
-    {
-      triplet_K_value = ( history_[ i ].triplet_Kminus_
-        * std::exp( ( history_[ i ].t_ - t ) * tau_minus_triplet_inv_ ) );
-      K_value = ( history_[ i ].Kminus_
-        * std::exp( ( history_[ i ].t_ - t ) * tau_minus_inv_ ) );
-      return;
-    }
-    i--;
-  }
 
-  // we only get here if t< time of all spikes in history)
+  // last spike before t
+  SpikeHistory::iterator it =
+    history_.lower_bound( t - kernel().connection_manager.get_stdp_eps() );
+  if ( it == history_.begin() )
+  {
+    // we only get here if t< time of all spikes in history)
 
-  // return 0.0 for both K values
-  triplet_K_value = 0.0;
-  K_value = 0.0;
+    // return 0.0 for both K values
+    triplet_K_value = 0.0;
+    K_value = 0.0;
+    return;
+  }
+  --it;
+  triplet_K_value = ( it->triplet_Kminus_
+    * std::exp( ( it->t_ - t ) * tau_minus_triplet_inv_ ) );
+  K_value = ( it->Kminus_ * std::exp( ( it->t_ - t ) * tau_minus_inv_ ) );
 }
 
 void
 nest::Archiving_Node::get_history( double t1,
   double t2,
-  std::deque< histentry >::iterator* start,
-  std::deque< histentry >::iterator* finish )
+  SpikeHistory::iterator* start,
+  SpikeHistory::iterator* finish )
 {
-  *finish = history_.end();
-  if ( history_.empty() )
+  // entries are sorted by time, so the range (t1, t2] is found by binary
+  // search
+  *start =
+    history_.lower_bound( t1 + kernel().connection_manager.get_stdp_eps() );
+  *finish =
+    history_.lower_bound( t2 + kernel().connection_manager.get_stdp_eps() );
+  if ( *finish < *start )
   {
     *start = *finish;
-    return;
-  }
-  std::deque< histentry >::reverse_iterator runner = history_.rbegin();
-  const double t2_lim = t2 + kernel().connection_manager.get_stdp_eps();
-  const double t1_lim = t1 + kernel().connection_manager.get_stdp_eps();
-  while ( runner != history_.rend() and runner->t_ >= t2_lim )
-  {
-    ++runner;
   }
-  *finish = runner.base();
-  while ( runner != history_.rend() and runner->t_ >= t1_lim )
+  for ( SpikeHistory::iterator runner = *start; runner < *finish; ++runner )
   {
     runner->access_counter_++;
-    ++runner;
   }
-  *start = runner.base();
 }
 
 void
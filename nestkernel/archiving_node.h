@@ -31,14 +31,12 @@
 #ifndef ARCHIVING_NODE_H
 #define ARCHIVING_NODE_H
 
-// C++ includes:
-#include <deque>
-
 // Includes from nestkernel:
 #include "histentry.h"
 #include "nest_time.h"
 #include "nest_types.h"
 #include "node.h"
+#include "spike_history.h"
 #include "synaptic_element.h"
 
 // Includes from sli:
@@ -143,23 +141,23 @@ public:
   void get_K_values( double t, double& Kminus, double& triplet_Kminus );
 
   /**
-   * \fn double get_triplet_K_value(std::deque<histentry>::iterator &iter)
+   * \fn double get_triplet_K_value(SpikeHistory::iterator &iter)
    * return the triplet Kminus value for the associated iterator.
    */
 
-  double get_triplet_K_value( const std::deque< histentry >::iterator& iter );
+  double get_triplet_K_value( const SpikeHistory::iterator& iter );
 
   /**
    * \fn void get_history(long t1, long t2,
-   * std::deque<Archiver::histentry>::iterator* start,
-   * std::deque<Archiver::histentry>::iterator* finish)
+   * SpikeHistory::iterator* start,
+   * SpikeHistory::iterator* finish)
    * return the spike times (in steps) of spikes which occurred in the range
-   * (t1,t2].
+   * (t1,t2]. The range is found by binary search in the spike history.
    */
   void get_history( double t1,
     double t2,
-    std::deque< histentry >::iterator* start,
-    std::deque< histentry >::iterator* finish );
+    SpikeHistory::iterator* start,
+    SpikeHistory::iterator* finish );
 
   /**
    * Register a new incoming STDP connection.
@@ -219,7 +217,7 @@ private:
   double last_spike_;
 
   // spiking history needed by stdp synapses
-  std::deque< histentry > history_;
+  SpikeHistory history_;
 
   /*
    * Structural plasticity
@@ -0,0 +1,271 @@
+/*
+ *  async_output_writer.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "async_output_writer.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+
+// Includes from libnestutil:
+#include "stopwatch.h"
+
+/* ----------------------------------------------------------------
+ * OutputBuffer
+ * ---------------------------------------------------------------- */
+
+nest::OutputBuffer::OutputBuffer()
+  : data_()
+{
+  reset_put_area_( 0 );
+}
+
+void
+nest::OutputBuffer::reset_put_area_( const size_t n )
+{
+  data_.resize( data_.capacity() );
+  if ( data_.empty() )
+  {
+    setp( 0, 0 );
+  }
+  else
+  {
+    setp( &data_[ 0 ], &data_[ 0 ] + data_.size() );
+    pbump( n );
+  }
+}
+
+void
+nest::OutputBuffer::swap( std::vector< char >& other )
+{
+  assert( other.empty() );
+  data_.resize( size() );
+  data_.swap( other );
+  reset_put_area_( 0 );
+}
+
+nest::OutputBuffer::int_type
+nest::OutputBuffer::overflow( int_type c )
+{
+  const size_t n = size();
+  data_.resize( std::max( 2 * data_.size(), static_cast< size_t >( 4096 ) ) );
+  reset_put_area_( n );
+
+  if ( not traits_type::eq_int_type( c, traits_type::eof() ) )
+  {
+    *pptr() = traits_type::to_char_type( c );
+    pbump( 1 );
+  }
+  return traits_type::not_eof( c );
+}
+
+/* ----------------------------------------------------------------
+ * AsyncOutputWriter
+ * ---------------------------------------------------------------- */
+
+nest::AsyncOutputWriter::AsyncOutputWriter()
+  : thread_()
+  , mutex_()
+  , job_queued_()
+  , job_written_()
+  , queue_()
+  , free_buffers_()
+  , queued_bytes_( 0 )
+  , max_queued_bytes_( 64 << 20 )
+  , stop_( false )
+  , wait_time_( 0.0 )
+  , write_time_( 0.0 )
+  , bytes_written_( 0 )
+{
+}
+
+nest::AsyncOutputWriter::~AsyncOutputWriter()
+{
+  stop();
+}
+
+void
+nest::AsyncOutputWriter::submit( std::ostream& stream,
+  std::vector< char >& data,
+  const bool flush )
+{
+  if ( data.empty() and not flush )
+  {
+    return;
+  }
+
+  std::unique_lock< std::mutex > lock( mutex_ );
+
+  if ( not thread_.joinable() )
+  {
+    stop_ = false;
+    thread_ = std::thread( &AsyncOutputWriter::run_, this );
+  }
+
+  // back-pressure: block until the data fit into the queue
+  if ( queued_bytes_ > 0 and queued_bytes_ + data.size() > max_queued_bytes_ )
+  {
+    Stopwatch sw;
+    sw.start();
+    while (
+      queued_bytes_ > 0 and queued_bytes_ + data.size() > max_queued_bytes_ )
+    {
+      job_written_.wait( lock );
+    }
+    sw.stop();
+    wait_time_ += sw.elapsed();
+  }
+
+  queue_.push_back( Job_() );
+  Job_& job = queue_.back();
+  job.stream = &stream;
+  job.flush = flush;
+  job.data.swap( data );
+  queued_bytes_ += job.data.size();
+
+  // hand an empty buffer back to the caller
+  if ( not free_buffers_.empty() )
+  {
+    data.swap( free_buffers_.back() );
+    free_buffers_.pop_back();
+  }
+
+  job_queued_.notify_one();
+}
+
+void
+nest::AsyncOutputWriter::wait()
+{
+  std::unique_lock< std::mutex > lock( mutex_ );
+  if ( queue_.empty() )
+  {
+    return;
+  }
+
+  Stopwatch sw;
+  sw.start();
+  while ( not queue_.empty() )
+  {
+    job_written_.wait( lock );
+  }
+  sw.stop();
+  wait_time_ += sw.elapsed();
+}
+
+void
+nest::AsyncOutputWriter::stop()
+{
+  {
+    std::lock_guard< std::mutex > lock( mutex_ );
+    stop_ = true;
+    job_queued_.notify_one();
+  }
+  if ( thread_.joinable() )
+  {
+    thread_.join();
+  }
+  free_buffers_.clear();
+}
+
+void
+nest::AsyncOutputWriter::run_()
+{
+  std::unique_lock< std::mutex > lock( mutex_ );
+  while ( true )
+  {
+    while ( queue_.empty() and not stop_ )
+    {
+      job_queued_.wait( lock );
+    }
+    if ( queue_.empty() )
+    {
+      return; // stop_ is set and all data have been written
+    }
+
+    // references to elements of a deque remain valid on push_back(), so
+    // the job can be written while other threads queue further jobs
+    Job_& job = queue_.front();
+    lock.unlock();
+
+    Stopwatch sw;
+    sw.start();
+    if ( not job.data.empty() )
+    {
+      job.stream->write( &job.data[ 0 ], job.data.size() );
+    }
+    if ( job.flush )
+    {
+      job.stream->flush();
+    }
+    sw.stop();
+
+    lock.lock();
+    write_time_ += sw.elapsed();
+    bytes_written_ += job.data.size();
+    queued_bytes_ -= job.data.size();
+    if ( free_buffers_.size() < max_free_buffers_ )
+    {
+      job.data.clear(); // keeps the capacity for reuse
+      free_buffers_.push_back( std::vector< char >() );
+      free_buffers_.back().swap( job.data );
+    }
+    queue_.pop_front();
+    job_written_.notify_all();
+  }
+}
+
+void
+nest::AsyncOutputWriter::set_max_queued_bytes( const size_t max_queued_bytes )
+{
+  std::lock_guard< std::mutex > lock( mutex_ );
+  max_queued_bytes_ = max_queued_bytes;
+}
+
+double
+nest::AsyncOutputWriter::get_wait_time() const
+{
+  std::lock_guard< std::mutex > lock( mutex_ );
+  return wait_time_;
+}
+
+double
+nest::AsyncOutputWriter::get_write_time() const
+{
+  std::lock_guard< std::mutex > lock( mutex_ );
+  return write_time_;
+}
+
+size_t
+nest::AsyncOutputWriter::get_bytes_written() const
+{
+  std::lock_guard< std::mutex > lock( mutex_ );
+  return bytes_written_;
+}
+
+void
+nest::AsyncOutputWriter::reset_counters()
+{
+  std::lock_guard< std::mutex > lock( mutex_ );
+  wait_time_ = 0.0;
+  write_time_ = 0.0;
+  bytes_written_ = 0;
+}
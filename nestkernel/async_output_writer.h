@@ -0,0 +1,169 @@
+/*
+ *  async_output_writer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ASYNC_OUTPUT_WRITER_H
+#define ASYNC_OUTPUT_WRITER_H
+
+// C++ includes:
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Stream buffer collecting output in memory.
+ *
+ * Recording devices writing asynchronously format their output into
+ * an std::ostream using this buffer. The data written is handed over
+ * with swap(), which gives the buffer the memory of an empty vector in
+ * return, so that no memory is allocated once the buffers have grown.
+ */
+class OutputBuffer : public std::streambuf
+{
+public:
+  OutputBuffer();
+
+  /**
+   * Exchange the data written with the given empty vector.
+   * On return, the vector contains the data written so far and the
+   * buffer continues writing into the memory of the vector.
+   */
+  void swap( std::vector< char >& );
+
+  //! Number of bytes written since the last swap()
+  size_t
+  size() const
+  {
+    return pptr() - pbase();
+  }
+
+protected:
+  int_type overflow( int_type );
+
+private:
+  //! Make all of data_ available for writing, keeping n bytes written
+  void reset_put_area_( const size_t n );
+
+  std::vector< char > data_;
+};
+
+/**
+ * Writer thread for output of recording devices.
+ *
+ * Recording devices hand over filled buffers with submit(), which
+ * returns immediately unless the data queued for writing exceed
+ * max_queued_bytes_. The buffers are written in order of submission
+ * by a background thread, so that simulation threads do not block on
+ * disk latency. The thread is started on the first submission and runs
+ * until stop() is called.
+ *
+ * Streams receiving data must not be accessed by the caller before
+ * wait() has returned.
+ */
+class AsyncOutputWriter
+{
+public:
+  AsyncOutputWriter();
+  ~AsyncOutputWriter();
+
+  /**
+   * Queue data for writing to stream.
+   *
+   * The data are taken over by swapping with a recycled, empty buffer.
+   * If the queue is full, the caller is blocked until enough data have
+   * been written. A buffer larger than the queue is accepted once the
+   * queue is empty.
+   *
+   * @param flush pass true to flush the stream after writing the data
+   */
+  void submit( std::ostream&, std::vector< char >&, const bool flush );
+
+  /**
+   * Block until all queued data have been written.
+   */
+  void wait();
+
+  /**
+   * Write all queued data and terminate the writer thread.
+   */
+  void stop();
+
+  void set_max_queued_bytes( const size_t );
+
+  size_t
+  get_max_queued_bytes() const
+  {
+    return max_queued_bytes_;
+  }
+
+  //! Seconds callers spent blocked in submit() and wait()
+  double get_wait_time() const;
+
+  //! Seconds the writer thread spent writing
+  double get_write_time() const;
+
+  //! Number of bytes written
+  size_t get_bytes_written() const;
+
+  void reset_counters();
+
+private:
+  //! Main loop of the writer thread
+  void run_();
+
+  struct Job_
+  {
+    std::ostream* stream;
+    std::vector< char > data;
+    bool flush;
+  };
+
+  std::thread thread_;
+  mutable std::mutex mutex_; //!< protects all data below
+
+  std::condition_variable job_queued_;  //!< signalled by submit()
+  std::condition_variable job_written_; //!< signalled by writer thread
+
+  std::deque< Job_ > queue_; //!< front is being written
+  std::vector< std::vector< char > > free_buffers_; //!< for recycling
+
+  size_t queued_bytes_;
+  size_t max_queued_bytes_;
+  bool stop_;
+
+  double wait_time_;
+  double write_time_;
+  size_t bytes_written_;
+
+  //! maximal number of empty buffers kept for recycling
+  static const size_t max_free_buffers_ = 64;
+};
+
+} // namespace nest
+
+#endif // ASYNC_OUTPUT_WRITER_H
@@ -0,0 +1,217 @@
+/*
+ *  batch_update.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BATCH_UPDATE_H
+#define BATCH_UPDATE_H
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+// Includes from nestkernel:
+#include "event.h"
+#include "event_delivery_manager_impl.h"
+#include "kernel_manager.h"
+#include "nest_time.h"
+#include "node.h"
+
+namespace nest
+{
+
+/**
+ * Bookkeeping for the batch update of a range of nodes of model NodeT.
+ *
+ * Models implementing Node::update_batch() use this class to select the
+ * nodes their batch kernel can advance, and to reproduce the behavior of
+ * calling update() on each node of the range afterwards: spikes found by
+ * the kernel are emitted node by node in the order of the range, and
+ * nodes excluded from the batch are updated individually at their
+ * position in the range. Frozen nodes are skipped.
+ *
+ * NodeT must declare this class a friend and provide
+ *   bool is_batch_updatable_() const;
+ * which returns false for nodes that need the individual update(), e.g.,
+ * because a multimeter is connected to them.
+ *
+ * Models keeping the state of the batch in arrays across time slices can
+ * select the nodes once per call to Run with select() and pass them to
+ * the constructor in each time slice, so that nodes are not visited
+ * for the selection in every slice.
+ */
+template < typename NodeT >
+class BatchUpdate
+{
+public:
+  /**
+   * Number of nodes a batch kernel advances together over all steps of a
+   * time slice, small enough for the arrays of a block to stay in the
+   * cache.
+   */
+  static const size_t block_size = 128;
+
+  //! Select the nodes of the range the batch kernel can advance
+  BatchUpdate( std::vector< Node* >::const_iterator first,
+    std::vector< Node* >::const_iterator last );
+
+  /**
+   * Use nodes selected by select() for the same range. The nodes of the
+   * range and their eligibility must not have changed since.
+   */
+  BatchUpdate( std::vector< Node* >::const_iterator first,
+    std::vector< Node* >::const_iterator last,
+    const std::vector< NodeT* >& nodes );
+
+  //! Store the nodes of the range the batch kernel can advance in nodes
+  static void select( std::vector< Node* >::const_iterator first,
+    std::vector< Node* >::const_iterator last,
+    std::vector< NodeT* >& nodes );
+
+  //! Return number of nodes in the batch
+  size_t size() const;
+
+  //! Return node with index i in the batch
+  NodeT& get_node( const size_t i ) const;
+
+  //! Register a spike of the node with index i in the batch at lag
+  void add_spike( const size_t i, const long lag );
+
+  /**
+   * Emit all registered spikes and update the nodes not in the batch.
+   * Must be called once after the batch kernel has advanced all nodes of
+   * the batch from step from to step to.
+   */
+  void finish( Time const& origin, const long from, const long to );
+
+private:
+  std::vector< Node* >::const_iterator first_;
+  std::vector< Node* >::const_iterator last_;
+
+  std::vector< NodeT* > selected_; //!< nodes selected by the constructor
+
+  //! nodes advanced by the batch kernel
+  const std::vector< NodeT* >& nodes_;
+
+  //! spikes as pairs of batch index and lag
+  std::vector< std::pair< size_t, long > > spikes_;
+};
+
+template < typename NodeT >
+BatchUpdate< NodeT >::BatchUpdate( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last )
+  : first_( first )
+  , last_( last )
+  , selected_()
+  , nodes_( selected_ )
+{
+  select( first, last, selected_ );
+}
+
+template < typename NodeT >
+BatchUpdate< NodeT >::BatchUpdate( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  const std::vector< NodeT* >& nodes )
+  : first_( first )
+  , last_( last )
+  , selected_()
+  , nodes_( nodes )
+{
+}
+
+template < typename NodeT >
+void
+BatchUpdate< NodeT >::select( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  std::vector< NodeT* >& nodes )
+{
+  nodes.clear();
+  nodes.reserve( last - first );
+  for ( std::vector< Node* >::const_iterator it = first; it != last; ++it )
+  {
+    assert( dynamic_cast< NodeT* >( *it ) != 0 );
+    NodeT* node = static_cast< NodeT* >( *it );
+    if ( not node->is_frozen() and node->is_batch_updatable_() )
+    {
+      nodes.push_back( node );
+    }
+  }
+}
+
+template < typename NodeT >
+inline size_t
+BatchUpdate< NodeT >::size() const
+{
+  return nodes_.size();
+}
+
+template < typename NodeT >
+inline NodeT&
+BatchUpdate< NodeT >::get_node( const size_t i ) const
+{
+  return *nodes_[ i ];
+}
+
+template < typename NodeT >
+inline void
+BatchUpdate< NodeT >::add_spike( const size_t i, const long lag )
+{
+  spikes_.push_back( std::make_pair( i, lag ) );
+}
+
+template < typename NodeT >
+void
+BatchUpdate< NodeT >::finish( Time const& origin,
+  const long from,
+  const long to )
+{
+  // batch kernels register spikes step by step, emit them node by node
+  std::sort( spikes_.begin(), spikes_.end() );
+
+  size_t i = 0;
+  typename std::vector< std::pair< size_t, long > >::const_iterator spike =
+    spikes_.begin();
+  for ( std::vector< Node* >::const_iterator it = first_; it != last_; ++it )
+  {
+    NodeT* node = static_cast< NodeT* >( *it );
+    if ( i < nodes_.size() and nodes_[ i ] == node )
+    {
+      for ( ; spike != spikes_.end() and spike->first == i; ++spike )
+      {
+        node->set_spiketime( Time::step( origin.get_steps() + spike->second
+          + 1 ) );
+
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( *node, se, spike->second );
+      }
+      ++i;
+    }
+    else if ( not node->is_frozen() )
+    {
+      node->update( origin, from, to );
+    }
+  }
+}
+
+} // namespace nest
+
+#endif /* BATCH_UPDATE_H */
@@ -0,0 +1,109 @@
+/*
+ *  columnar_file_writer.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "columnar_file_writer.h"
+
+nest::ColumnarFileWriter::ColumnarFileWriter()
+  : columns_()
+  , next_column_( 0 )
+  , n_rows_( 0 )
+  , buffered_size_( 0 )
+{
+}
+
+void
+nest::ColumnarFileWriter::clear_columns()
+{
+  columns_.clear();
+  next_column_ = 0;
+  n_rows_ = 0;
+  buffered_size_ = 0;
+}
+
+void
+nest::ColumnarFileWriter::add_column( const std::string& name,
+  const ColumnType type )
+{
+  assert( n_rows_ == 0 and next_column_ == 0 );
+  assert( name.size() < 256 );
+  columns_.push_back( Column_( name, type ) );
+}
+
+bool
+nest::ColumnarFileWriter::has_same_columns(
+  const ColumnarFileWriter& other ) const
+{
+  if ( columns_.size() != other.columns_.size() )
+  {
+    return false;
+  }
+  for ( size_t c = 0; c < columns_.size(); ++c )
+  {
+    if ( columns_[ c ].name != other.columns_[ c ].name
+      or columns_[ c ].type != other.columns_[ c ].type )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void
+nest::ColumnarFileWriter::write_header( std::ostream& os,
+  const double resolution ) const
+{
+  std::vector< char > header;
+  const char magic[ 8 ] = { 'N', 'E', 'S', 'T', 'C', 'O', 'L', '\0' };
+  header.insert( header.end(), magic, magic + 8 );
+  append_( header, static_cast< uint32_t >( version_ ) );
+  append_( header, static_cast< uint32_t >( 0x01020304 ) );
+  append_( header, resolution );
+  append_( header, static_cast< uint32_t >( columns_.size() ) );
+  for ( size_t c = 0; c < columns_.size(); ++c )
+  {
+    header.push_back( static_cast< char >( columns_[ c ].type ) );
+    header.push_back( static_cast< char >( columns_[ c ].name.size() ) );
+    header.insert(
+      header.end(), columns_[ c ].name.begin(), columns_[ c ].name.end() );
+  }
+  os.write( &header[ 0 ], header.size() );
+}
+
+void
+nest::ColumnarFileWriter::write_chunk( std::ostream& os )
+{
+  assert( next_column_ == 0 );
+  if ( n_rows_ == 0 )
+  {
+    return;
+  }
+
+  os.write( reinterpret_cast< const char* >( &n_rows_ ), sizeof( uint64_t ) );
+  for ( size_t c = 0; c < columns_.size(); ++c )
+  {
+    os.write( &columns_[ c ].data[ 0 ], columns_[ c ].data.size() );
+    // clear() keeps the capacity of the buffer
+    columns_[ c ].data.clear();
+  }
+  n_rows_ = 0;
+  buffered_size_ = 0;
+}
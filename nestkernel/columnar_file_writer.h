@@ -0,0 +1,200 @@
+/*
+ *  columnar_file_writer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COLUMNAR_FILE_WRITER_H
+#define COLUMNAR_FILE_WRITER_H
+
+// C++ includes:
+#include <cassert>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Buffered writer for files in the columnar format of recording devices.
+ *
+ * Records are collected row by row, but buffered column by column. Once
+ * the buffer exceeds chunk_size_ bytes, or when write_chunk() is called,
+ * all buffered rows are written to the file as one chunk, in which the
+ * values of each column are stored contiguously. No formatting takes
+ * place, values are written in their binary representation.
+ *
+ * Layout of a file, all numbers in the byte order of the writing machine:
+ *
+ *   char[8]   magic string "NESTCOL" terminated by '\0'
+ *   uint32    format version
+ *   uint32    byte order mark 0x01020304
+ *   float64   simulation resolution in ms
+ *   uint32    number of columns
+ *   for each column:
+ *     uint8   type code: 'u' uint64, 'i' int64, 'd' float64, 'f' float32
+ *     uint8   length of the column name
+ *     char[]  column name, not terminated
+ *   for each chunk until end of file:
+ *     uint64  number of rows n
+ *     for each column: n values of the type of the column
+ *
+ * @see pynest/nest/columnar.py for a reader
+ */
+class ColumnarFileWriter
+{
+public:
+  enum ColumnType
+  {
+    UINT64 = 'u',
+    INT64 = 'i',
+    FLOAT64 = 'd',
+    FLOAT32 = 'f'
+  };
+
+  ColumnarFileWriter();
+
+  /**
+   * Remove all columns and discard all buffered rows.
+   */
+  void clear_columns();
+
+  /**
+   * Append a column to the layout.
+   * Must not be called while rows are buffered.
+   */
+  void add_column( const std::string& name, const ColumnType type );
+
+  size_t
+  get_num_columns() const
+  {
+    return columns_.size();
+  }
+
+  /**
+   * Return true if both writers have the same columns.
+   */
+  bool has_same_columns( const ColumnarFileWriter& ) const;
+
+  /**
+   * Write the header describing the columns to the given stream.
+   */
+  void write_header( std::ostream&, const double resolution ) const;
+
+  /**
+   * Append a value to the next column of the current row.
+   * The value is converted to the type of the column.
+   */
+  template < typename ValueT >
+  void put( const ValueT value );
+
+  /**
+   * Complete the current row.
+   * @return true if the buffered rows should be written to file
+   */
+  bool end_row();
+
+  /**
+   * Write all buffered rows as one chunk to the given stream.
+   * Does nothing if no rows are buffered.
+   */
+  void write_chunk( std::ostream& );
+
+private:
+  struct Column_
+  {
+    Column_( const std::string& n, const ColumnType t )
+      : name( n )
+      , type( t )
+      , data()
+    {
+    }
+
+    std::string name;
+    ColumnType type;
+    std::vector< char > data; //!< values of buffered rows
+  };
+
+  //! append binary representation of value to buffer
+  template < typename T >
+  static void append_( std::vector< char >&, const T value );
+
+  std::vector< Column_ > columns_;
+  size_t next_column_;   //!< column receiving the next value of current row
+  uint64_t n_rows_;      //!< number of completed rows in buffer
+  size_t buffered_size_; //!< number of bytes in buffer
+
+  //! number of buffered bytes that triggers writing a chunk
+  static const size_t chunk_size_ = 1 << 22;
+
+  static const unsigned int version_ = 1;
+};
+
+template < typename T >
+inline void
+ColumnarFileWriter::append_( std::vector< char >& buffer, const T value )
+{
+  const char* const bytes = reinterpret_cast< const char* >( &value );
+  buffer.insert( buffer.end(), bytes, bytes + sizeof( T ) );
+}
+
+template < typename ValueT >
+inline void
+ColumnarFileWriter::put( const ValueT value )
+{
+  assert( next_column_ < columns_.size() );
+  Column_& column = columns_[ next_column_ ];
+  switch ( column.type )
+  {
+  case UINT64:
+    append_( column.data, static_cast< uint64_t >( value ) );
+    buffered_size_ += sizeof( uint64_t );
+    break;
+  case INT64:
+    append_( column.data, static_cast< int64_t >( value ) );
+    buffered_size_ += sizeof( int64_t );
+    break;
+  case FLOAT64:
+    append_( column.data, static_cast< double >( value ) );
+    buffered_size_ += sizeof( double );
+    break;
+  case FLOAT32:
+    append_( column.data, static_cast< float >( value ) );
+    buffered_size_ += sizeof( float );
+    break;
+  }
+  ++next_column_;
+}
+
+inline bool
+ColumnarFileWriter::end_row()
+{
+  assert( next_column_ == columns_.size() );
+  next_column_ = 0;
+  ++n_rows_;
+  return buffered_size_ >= chunk_size_;
+}
+
+} // namespace nest
+
+#endif // COLUMNAR_FILE_WRITER_H
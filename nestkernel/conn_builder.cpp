@@ -64,6 +64,7 @@ nest::ConnBuilder::ConnBuilder( const GIDCollection& sources,
   , weight_( 0 )
   , delay_( 0 )
   , param_dicts_()
+  , pending_connections_( kernel().vp_manager.get_num_threads() )
   , parameters_requiring_skipping_()
 {
   // read out rule-related parameters -------------------------
@@ -378,6 +379,8 @@ nest::ConnBuilder::connect()
     }
   }
 
+  flush_connections_();
+
   // check if any exceptions have been raised
   for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
   {
@@ -428,44 +431,38 @@ nest::ConnBuilder::single_connect_( index sgid,
 
   if ( param_dicts_.empty() ) // indicates we have no synapse params
   {
-    const DictionaryDatum params = new Dictionary; // empty parameter dictionary
-    // required by connect() calls
+    // collect connection, it is created in bulk with other connections by
+    // flush_connections_()
+    PendingConnections_& pending = pending_connections_[ target_thread ];
+    pending.sgids.push_back( sgid );
+    pending.targets.push_back( &target );
 
     if ( default_weight_and_delay_ )
     {
-      kernel().connection_manager.connect(
-        sgid, &target, target_thread, synapse_model_id_, params );
+      pending.delays.push_back( numerics::nan );
+      pending.weights.push_back( numerics::nan );
     }
     else if ( default_weight_ )
     {
-      kernel().connection_manager.connect( sgid,
-        &target,
-        target_thread,
-        synapse_model_id_,
-        params,
-        delay_->value_double( target_thread, rng ) );
+      pending.delays.push_back( delay_->value_double( target_thread, rng ) );
+      pending.weights.push_back( numerics::nan );
     }
     else if ( default_delay_ )
     {
-      kernel().connection_manager.connect( sgid,
-        &target,
-        target_thread,
-        synapse_model_id_,
-        params,
-        numerics::nan,
-        weight_->value_double( target_thread, rng ) );
+      pending.delays.push_back( numerics::nan );
+      pending.weights.push_back( weight_->value_double( target_thread, rng ) );
     }
     else
     {
       double delay = delay_->value_double( target_thread, rng );
       double weight = weight_->value_double( target_thread, rng );
-      kernel().connection_manager.connect( sgid,
-        &target,
-        target_thread,
-        synapse_model_id_,
-        params,
-        delay,
-        weight );
+      pending.delays.push_back( delay );
+      pending.weights.push_back( weight );
+    }
+
+    if ( pending.sgids.size() >= max_pending_connections_ )
+    {
+      flush_connections_( target_thread );
     }
   }
   else
@@ -555,6 +552,64 @@ nest::ConnBuilder::single_connect_( index sgid,
   }
 }
 
+void
+nest::ConnBuilder::PendingConnections_::clear()
+{
+  sgids.clear();
+  targets.clear();
+  delays.clear();
+  weights.clear();
+}
+
+void
+nest::ConnBuilder::flush_connections_( const thread tid )
+{
+  PendingConnections_& pending = pending_connections_[ tid ];
+
+  // clear pending connections also if creating one of them throws, so that
+  // they are not created again
+  try
+  {
+    kernel().connection_manager.connect_bulk( tid,
+      synapse_model_id_,
+      pending.sgids,
+      pending.targets,
+      pending.delays,
+      pending.weights );
+  }
+  catch ( ... )
+  {
+    pending.clear();
+    throw;
+  }
+  pending.clear();
+}
+
+void
+nest::ConnBuilder::flush_connections_()
+{
+#pragma omp parallel
+  {
+    const thread tid = kernel().vp_manager.get_thread_id();
+
+    try
+    {
+      flush_connections_( tid );
+    }
+    catch ( std::exception& err )
+    {
+      // keep the exception raised while collecting the connections
+      if ( not exceptions_raised_.at( tid ).valid() )
+      {
+        // We must create a new exception here, err's lifetime ends at
+        // the end of the catch block.
+        exceptions_raised_.at( tid ) = lockPTR< WrappedThreadException >(
+          new WrappedThreadException( err ) );
+      }
+    }
+  }
+}
+
 void
 nest::ConnBuilder::set_pre_synaptic_element_name( const std::string& name )
 {
@@ -607,6 +662,84 @@ nest::ConnBuilder::loop_over_targets_() const
     or not targets_->is_range() or parameters_requiring_skipping_.size() > 0;
 }
 
+void
+nest::ConnBuilder::partition_targets_()
+{
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  local_targets_.resize( num_threads );
+  for ( thread tid = 0; tid < num_threads; ++tid )
+  {
+    local_targets_[ tid ].clear();
+  }
+
+  if ( loop_over_targets_() )
+  {
+    const bool skipping = not parameters_requiring_skipping_.empty();
+
+    // array parameter values used by all targets in front of the current
+    // one, and by all targets in front of the next target of each thread
+    size_t num_params = 0;
+    std::vector< size_t > num_params_next( num_threads, 0 );
+
+    size_t position = 0;
+    for ( GIDCollection::const_iterator tgid = targets_->begin();
+          tgid != targets_->end();
+          ++tgid, ++position )
+    {
+      const size_t num_target_params =
+        skipping ? num_conn_parameters_( position ) : 0;
+
+      // check whether the target is on this mpi machine
+      if ( kernel().node_manager.is_local_gid( *tgid ) )
+      {
+        Node* const target = kernel().node_manager.get_node( *tgid );
+        if ( target->has_proxies() or target->one_node_per_process() )
+        {
+          const thread tid = target->get_thread();
+          local_targets_[ tid ].push_back( LocalTarget_(
+            target, *tgid, position, num_params - num_params_next[ tid ] ) );
+          num_params_next[ tid ] = num_params + num_target_params;
+        }
+        else
+        {
+          // devices have an instance on every thread
+          for ( thread tid = 0; tid < num_threads; ++tid )
+          {
+            local_targets_[ tid ].push_back(
+              LocalTarget_( kernel().node_manager.get_node( *tgid, tid ),
+                *tgid,
+                position,
+                num_params - num_params_next[ tid ] ) );
+            num_params_next[ tid ] = num_params + num_target_params;
+          }
+        }
+      }
+
+      num_params += num_target_params;
+    }
+  }
+  else
+  {
+    for ( SparseNodeArray::const_iterator it =
+            kernel().node_manager.local_nodes_begin();
+          it != kernel().node_manager.local_nodes_end();
+          ++it )
+    {
+      const index tgid = ( *it ).get_gid();
+      const int position = targets_->find( tgid );
+      if ( position < 0 ) // Is local node in target list?
+      {
+        continue;
+      }
+
+      // no parameter requires skipping, see loop_over_targets_()
+      Node* const target = ( *it ).get_node();
+      local_targets_[ target->get_thread() ].push_back(
+        LocalTarget_( target, tgid, position, 0 ) );
+    }
+  }
+}
+
 nest::OneToOneBuilder::OneToOneBuilder( const GIDCollection& sources,
   const GIDCollection& targets,
   const DictionaryDatum& conn_spec,
@@ -621,9 +754,19 @@ nest::OneToOneBuilder::OneToOneBuilder( const GIDCollection& sources,
   }
 }
 
+size_t
+nest::OneToOneBuilder::num_conn_parameters_( const size_t position ) const
+{
+  // excluded autapses do not use parameters
+  return autapses_ or ( *sources_ )[ position ] != ( *targets_ )[ position ]
+    ? 1
+    : 0;
+}
+
 void
 nest::OneToOneBuilder::connect_()
 {
+  partition_targets_();
 
 #pragma omp parallel
   {
@@ -632,83 +775,26 @@ nest::OneToOneBuilder::connect_()
 
     try
     {
-      const size_t expected_targets =
-        std::ceil( targets_->size()
-          / static_cast< double >(
-                     kernel().vp_manager.get_num_virtual_processes() ) );
-
       // allocate pointer to thread specific random generator
       librandom::RngPtr rng = kernel().rng_manager.get_rng( tid );
 
-      if ( loop_over_targets_() )
+      for ( std::vector< LocalTarget_ >::const_iterator target =
+              local_targets_[ tid ].begin();
+            target != local_targets_[ tid ].end();
+            ++target )
       {
-        for ( GIDCollection::const_iterator tgid = targets_->begin(),
-                                            sgid = sources_->begin();
-              tgid != targets_->end();
-              ++tgid, ++sgid )
-        {
-          assert( sgid != sources_->end() );
+        // skip array parameters of the targets handled by other threads
+        // or processes
+        skip_conn_parameter_( tid, target->n_skip );
 
-          if ( *sgid == *tgid and not autapses_ )
-          {
-            continue;
-          }
-
-          // check whether the target is on this mpi machine
-          if ( not kernel().node_manager.is_local_gid( *tgid ) )
-          {
-            skip_conn_parameter_( tid );
-            continue;
-          }
-
-          Node* const target = kernel().node_manager.get_node( *tgid, tid );
-          const thread target_thread = target->get_thread();
-
-          // check whether the target is on our thread
-          if ( tid != target_thread )
-          {
-            skip_conn_parameter_( tid );
-            continue;
-          }
-
-          single_connect_( *sgid, *target, target_thread, rng );
-        }
-      }
-      else
-      {
-        for ( SparseNodeArray::const_iterator it =
-                kernel().node_manager.local_nodes_begin();
-              it != kernel().node_manager.local_nodes_end();
-              ++it )
+        // one-to-one, thus we can use target position for source as well
+        const index sgid = ( *sources_ )[ target->position ];
+        if ( not autapses_ and sgid == target->gid )
         {
-          Node* const target = ( *it ).get_node();
-          const thread target_thread = target->get_thread();
-
-          if ( tid != target_thread )
-          {
-            // no skipping required / possible,
-            // as we iterate only over local nodes
-            continue;
-          }
-
-          const index tgid = ( *it ).get_gid();
-          const int idx = targets_->find( tgid );
-          if ( idx < 0 ) // Is local node in target list?
-          {
-            continue;
-          }
-
-          // one-to-one, thus we can use target idx for source as well
-          const index sgid = ( *sources_ )[ idx ];
-          if ( not autapses_ and sgid == tgid )
-          {
-            // no skipping required / possible,
-            // as we iterate only over local nodes
-            continue;
-          }
-
-          single_connect_( sgid, *target, target_thread, rng );
+          continue;
         }
+
+        single_connect_( sgid, *target->node, tid, rng );
       }
     }
     catch ( std::exception& err )
@@ -878,6 +964,7 @@ nest::OneToOneBuilder::sp_disconnect_()
 void
 nest::AllToAllBuilder::connect_()
 {
+  partition_targets_();
 
 #pragma omp parallel
   {
@@ -886,50 +973,19 @@ nest::AllToAllBuilder::connect_()
 
     try
     {
-      const size_t expected_targets =
-        std::ceil( sources_->size() * targets_->size()
-          / static_cast< double >(
-                     kernel().vp_manager.get_num_virtual_processes() ) );
-
       // allocate pointer to thread specific random generator
       librandom::RngPtr rng = kernel().rng_manager.get_rng( tid );
 
-      if ( loop_over_targets_() )
+      for ( std::vector< LocalTarget_ >::const_iterator target =
+              local_targets_[ tid ].begin();
+            target != local_targets_[ tid ].end();
+            ++target )
       {
-        for ( GIDCollection::const_iterator tgid = targets_->begin();
-              tgid != targets_->end();
-              ++tgid )
-        {
-          // check whether the target is on this mpi machine
-          if ( not kernel().node_manager.is_local_gid( *tgid ) )
-          {
-            skip_conn_parameter_( tid, sources_->size() );
-            continue;
-          }
-
-          Node* const target = kernel().node_manager.get_node( *tgid, tid );
+        // skip array parameters of the targets handled by other threads
+        // or processes
+        skip_conn_parameter_( tid, target->n_skip );
 
-          inner_connect_( tid, rng, target, *tgid, true );
-        }
-      }
-      else
-      {
-        for ( SparseNodeArray::const_iterator it =
-                kernel().node_manager.local_nodes_begin();
-              it != kernel().node_manager.local_nodes_end();
-              ++it )
-        {
-          Node* const target = ( *it ).get_node();
-          const index tgid = ( *it ).get_gid();
-
-          // Is the local node in the targets list?
-          if ( targets_->find( tgid ) < 0 )
-          {
-            continue;
-          }
-
-          inner_connect_( tid, rng, target, tgid, false );
-        }
+        inner_connect_( tid, rng, target->node, target->gid );
       }
     }
     catch ( std::exception& err )
@@ -946,35 +1002,19 @@ void
 nest::AllToAllBuilder::inner_connect_( const int tid,
   librandom::RngPtr& rng,
   Node* target,
-  index tgid,
-  bool skip )
+  index tgid )
 {
-  const thread target_thread = target->get_thread();
-
-  // check whether the target is on our thread
-  if ( tid != target_thread )
-  {
-    if ( skip )
-    {
-      skip_conn_parameter_( tid, sources_->size() );
-    }
-    return;
-  }
-
   for ( GIDCollection::const_iterator sgid = sources_->begin();
         sgid != sources_->end();
         ++sgid )
   {
     if ( not autapses_ and *sgid == tgid )
     {
-      if ( skip )
-      {
-        skip_conn_parameter_( target_thread );
-      }
+      skip_conn_parameter_( tid );
       continue;
     }
 
-    single_connect_( *sgid, *target, target_thread, rng );
+    single_connect_( *sgid, *target, tid, rng );
   }
 }
 
@@ -1178,6 +1218,8 @@ nest::FixedInDegreeBuilder::FixedInDegreeBuilder( const GIDCollection& sources,
 void
 nest::FixedInDegreeBuilder::connect_()
 {
+  partition_targets_();
+
 #pragma omp parallel
   {
     // get thread id
@@ -1185,51 +1227,18 @@ nest::FixedInDegreeBuilder::connect_()
 
     try
     {
-      const size_t expected_targets =
-        std::ceil( targets_->size()
-          / static_cast< double >(
-                     kernel().vp_manager.get_num_virtual_processes() ) );
-
       // allocate pointer to thread specific random generator
       librandom::RngPtr rng = kernel().rng_manager.get_rng( tid );
 
-      if ( loop_over_targets_() )
+      for ( std::vector< LocalTarget_ >::const_iterator target =
+              local_targets_[ tid ].begin();
+            target != local_targets_[ tid ].end();
+            ++target )
       {
-        for ( GIDCollection::const_iterator tgid = targets_->begin();
-              tgid != targets_->end();
-              ++tgid )
-        {
-          // check whether the target is on this mpi machine
-          if ( not kernel().node_manager.is_local_gid( *tgid ) )
-          {
-            // skip array parameters handled in other virtual processes
-            skip_conn_parameter_( tid, indegree_ );
-            continue;
-          }
-
-          Node* target = kernel().node_manager.get_node( *tgid, tid );
-
-          inner_connect_( tid, rng, target, *tgid, true );
-        }
-      }
-      else
-      {
-        for ( SparseNodeArray::const_iterator it =
-                kernel().node_manager.local_nodes_begin();
-              it != kernel().node_manager.local_nodes_end();
-              ++it )
-        {
-          Node* const target = ( *it ).get_node();
-          const index tgid = ( *it ).get_gid();
-
-          // Is the local node in the targets list?
-          if ( targets_->find( tgid ) < 0 )
-          {
-            continue;
-          }
+        // skip array parameters handled in other virtual processes
+        skip_conn_parameter_( tid, target->n_skip );
 
-          inner_connect_( tid, rng, target, tgid, false );
-        }
+        inner_connect_( tid, rng, target->node, target->gid );
       }
     }
     catch ( std::exception& err )
@@ -1246,22 +1255,8 @@ void
 nest::FixedInDegreeBuilder::inner_connect_( const int tid,
   librandom::RngPtr& rng,
   Node* target,
-  index tgid,
-  bool skip )
+  index tgid )
 {
-  const thread target_thread = target->get_thread();
-
-  // check whether the target is on our thread
-  if ( tid != target_thread )
-  {
-    // skip array parameters handled in other virtual processes
-    if ( skip )
-    {
-      skip_conn_parameter_( tid, indegree_ );
-    }
-    return;
-  }
-
   std::set< long > ch_ids;
   long n_rnd = sources_->size();
 
@@ -1282,7 +1277,7 @@ nest::FixedInDegreeBuilder::inner_connect_( const int tid,
       ch_ids.insert( s_id );
     }
 
-    single_connect_( sgid, *target, target_thread, rng );
+    single_connect_( sgid, *target, tid, rng );
   }
 }
 
@@ -1616,62 +1611,24 @@ nest::BernoulliBuilder::BernoulliBuilder( const GIDCollection& sources,
 void
 nest::BernoulliBuilder::connect_()
 {
+  partition_targets_();
+
 #pragma omp parallel
   {
     // get thread id
     const thread tid = kernel().vp_manager.get_thread_id();
 
-    // compute expected number of connections from binomial
-    // distribution; estimate an upper bound by assuming Gaussianity
-    const size_t max_num_connections =
-      std::ceil( float( targets_->size() ) * float( sources_->size() )
-        / kernel().vp_manager.get_num_virtual_processes() );
-
-    const size_t expected_num_connections = max_num_connections * p_;
-    const size_t std_num_connections =
-      std::sqrt( max_num_connections * p_ * ( 1 - p_ ) );
-
     try
     {
       // allocate pointer to thread specific random generator
       librandom::RngPtr rng = kernel().rng_manager.get_rng( tid );
 
-      if ( loop_over_targets_() )
+      for ( std::vector< LocalTarget_ >::const_iterator target =
+              local_targets_[ tid ].begin();
+            target != local_targets_[ tid ].end();
+            ++target )
       {
-        for ( GIDCollection::const_iterator tgid = targets_->begin();
-              tgid != targets_->end();
-              ++tgid )
-        {
-          // check whether the target is on this mpi machine
-          if ( not kernel().node_manager.is_local_gid( *tgid ) )
-          {
-            continue;
-          }
-
-          Node* const target = kernel().node_manager.get_node( *tgid, tid );
-
-          inner_connect_( tid, rng, target, *tgid );
-        }
-      }
-
-      else
-      {
-        for ( SparseNodeArray::const_iterator it =
-                kernel().node_manager.local_nodes_begin();
-              it != kernel().node_manager.local_nodes_end();
-              ++it )
-        {
-          Node* const target = ( *it ).get_node();
-          const index tgid = ( *it ).get_gid();
-
-          // Is the local node in the targets list?
-          if ( targets_->find( tgid ) < 0 )
-          {
-            continue;
-          }
-
-          inner_connect_( tid, rng, target, tgid );
-        }
+        inner_connect_( tid, rng, target->node, target->gid );
       }
     }
     catch ( std::exception& err )
@@ -1690,14 +1647,6 @@ nest::BernoulliBuilder::inner_connect_( const int tid,
   Node* target,
   index tgid )
 {
-  const thread target_thread = target->get_thread();
-
-  // check whether the target is on our thread
-  if ( tid != target_thread )
-  {
-    return;
-  }
-
   // It is not possible to create multapses with this type of BernoulliBuilder,
   // hence leave out corresponding checks.
 
@@ -1715,7 +1664,7 @@ nest::BernoulliBuilder::inner_connect_( const int tid,
       continue;
     }
 
-    single_connect_( *sgid, *target, target_thread, rng );
+    single_connect_( *sgid, *target, tid, rng );
   }
 }
 
@@ -1929,6 +1878,7 @@ void
 nest::SPBuilder::sp_connect( GIDCollection sources, GIDCollection targets )
 {
   connect_( sources, targets );
+  flush_connections_();
 
   // check if any exceptions have been raised
   for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
@@ -151,6 +151,14 @@ protected:
   void single_connect_( index, Node&, thread, librandom::RngPtr& );
   void single_disconnect_( index, Node&, thread );
 
+  /**
+   * Create the connections collected by single_connect_() on all threads.
+   *
+   * Must be called after connect_() or sp_connect_() have returned.
+   * Exceptions are stored in exceptions_raised_.
+   */
+  void flush_connections_();
+
   /**
    * Moves pointer in parameter array.
    *
@@ -178,6 +186,54 @@ protected:
    */
   bool loop_over_targets_() const;
 
+  /**
+   * Target node living on a thread, as collected by partition_targets_().
+   */
+  struct LocalTarget_
+  {
+    LocalTarget_( Node* n, const index g, const size_t p, const size_t s )
+      : node( n )
+      , gid( g )
+      , position( p )
+      , n_skip( s )
+    {
+    }
+
+    Node* node;      //!< target node on the thread
+    index gid;       //!< GID of the target
+    size_t position; //!< position of the target in targets_
+    size_t n_skip;   //!< array parameters to skip before this target
+  };
+
+  /**
+   * Distributes the targets local to this MPI process among the threads.
+   *
+   * Visits targets_ (or the local nodes, see loop_over_targets_()) once
+   * and stores the targets living on thread tid in local_targets_[ tid ],
+   * ordered by their position in targets_. Thus, each thread iterates
+   * only over its own targets inside connect_() instead of checking all
+   * targets for locality. The number of array parameters used by the
+   * targets in between, which the thread must skip, is computed here
+   * once and stored in LocalTarget_::n_skip. It is zero if no parameter
+   * requires skipping.
+   *
+   * Must be called outside of parallel regions.
+   */
+  void partition_targets_();
+
+  /**
+   * Returns the number of array parameter values used by the target at
+   * the given position in targets_, see partition_targets_().
+   */
+  virtual size_t
+  num_conn_parameters_( const size_t ) const
+  {
+    return 0;
+  }
+
+  //! local targets of each thread, see partition_targets_()
+  std::vector< std::vector< LocalTarget_ > > local_targets_;
+
   GIDCollection const* sources_;
   GIDCollection const* targets_;
 
@@ -227,6 +283,30 @@ private:
   //! dictionaries to pass to connect function, one per thread
   std::vector< DictionaryDatum > param_dicts_;
 
+  /**
+   * Connections without synapse parameters collected by single_connect_(),
+   * which are created in bulk by ConnectionManager::connect_bulk() to avoid
+   * the overhead of creating each connection individually.
+   */
+  struct PendingConnections_
+  {
+    std::vector< index > sgids;
+    std::vector< Node* > targets;
+    std::vector< double > delays;
+    std::vector< double > weights;
+
+    void clear();
+  };
+
+  //! pending connections, one entry per thread
+  std::vector< PendingConnections_ > pending_connections_;
+
+  //! number of pending connections of a thread that triggers their creation
+  static const size_t max_pending_connections_ = 4096;
+
+  //! Create pending connections of thread tid
+  void flush_connections_( const thread tid );
+
   /**
    * Collects all array paramters in a vector.
    *
@@ -266,6 +346,9 @@ protected:
   void sp_connect_();
   void disconnect_();
   void sp_disconnect_();
+
+private:
+  size_t num_conn_parameters_( const size_t ) const;
 };
 
 class AllToAllBuilder : public ConnBuilder
@@ -298,7 +381,13 @@ protected:
   void sp_disconnect_();
 
 private:
-  void inner_connect_( const int, librandom::RngPtr&, Node*, index, bool );
+  void inner_connect_( const int, librandom::RngPtr&, Node*, index );
+
+  size_t
+  num_conn_parameters_( const size_t ) const
+  {
+    return sources_->size();
+  }
 };
 
 
@@ -314,7 +403,14 @@ protected:
   void connect_();
 
 private:
-  void inner_connect_( const int, librandom::RngPtr&, Node*, index, bool );
+  void inner_connect_( const int, librandom::RngPtr&, Node*, index );
+
+  size_t
+  num_conn_parameters_( const size_t ) const
+  {
+    return indegree_;
+  }
+
   long indegree_;
 };
 
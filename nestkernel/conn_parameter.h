@@ -240,7 +240,7 @@ public:
   void
   skip( thread tid, size_t n_skip ) const
   {
-    if ( next_[ tid ] < values_->end() )
+    if ( n_skip <= static_cast< size_t >( values_->end() - next_[ tid ] ) )
     {
       next_[ tid ] += n_skip;
     }
@@ -327,7 +327,7 @@ public:
   void
   skip( thread tid, size_t n_skip ) const
   {
-    if ( next_[ tid ] < values_->end() )
+    if ( n_skip <= static_cast< size_t >( values_->end() - next_[ tid ] ) )
     {
       next_[ tid ] += n_skip;
     }
@@ -31,12 +31,14 @@
 #include <cmath>
 #include <iomanip>
 #include <limits>
+#include <numeric>
 #include <set>
 #include <vector>
 
 // Includes from libnestutil:
 #include "compose.hpp"
 #include "logging.h"
+#include "numa_utils.h"
 
 // Includes from nestkernel:
 #include "conn_builder.h"
@@ -61,6 +63,8 @@
 #include "token.h"
 #include "tokenutils.h"
 
+const double nest::ConnectionManager::max_incremental_fraction_ = 0.1;
+
 nest::ConnectionManager::ConnectionManager()
   : connruledict_( new Dictionary() )
   , connbuilder_factories_()
@@ -69,6 +73,10 @@ nest::ConnectionManager::ConnectionManager()
   , keep_source_table_( true )
   , have_connections_changed_( true )
   , sort_connections_by_source_( true )
+  , needs_full_update_( false )
+  , incremental_update_( false )
+  , num_connections_full_update_( 0 )
+  , num_disabled_connections_()
   , has_primary_connections_( false )
   , secondary_connections_exist_( false )
   , stdp_eps_( 1.0e-6 )
@@ -92,6 +100,10 @@ nest::ConnectionManager::initialize()
   connections_.resize( num_threads );
   secondary_recv_buffer_pos_.resize( num_threads );
   sort_connections_by_source_ = true;
+  needs_full_update_ = false;
+  incremental_update_ = false;
+  num_connections_full_update_ = 0;
+  num_disabled_connections_.assign( num_threads, 0 );
 
 #pragma omp parallel
   {
@@ -137,6 +149,9 @@ nest::ConnectionManager::set_status( const DictionaryDatum& d )
     delay_checkers_[ i ].set_status( d );
   }
 
+  const bool keep_source_table = keep_source_table_;
+  const bool sort_connections_by_source = sort_connections_by_source_;
+
   updateValue< bool >( d, names::keep_source_table, keep_source_table_ );
   if ( not keep_source_table_
     and kernel().sp_manager.is_structural_plasticity_enabled() )
@@ -155,6 +170,15 @@ nest::ConnectionManager::set_status( const DictionaryDatum& d )
       "If structural plasticity is enabled, sort_connections_by_source can not "
       "be set to false." );
   }
+
+  // connections created before the change are not sorted or not kept
+  // in the same way as new ones
+  if ( keep_source_table_ != keep_source_table
+    or sort_connections_by_source_ != sort_connections_by_source )
+  {
+    needs_full_update_ = true;
+  }
+
   //  Need to update the saved values if we have changed the delay bounds.
   if ( d->known( names::min_delay ) or d->known( names::max_delay ) )
   {
@@ -182,6 +206,25 @@ nest::ConnectionManager::get_status( DictionaryDatum& dict )
   def< bool >( dict, names::keep_source_table, keep_source_table_ );
   def< bool >(
     dict, names::sort_connections_by_source, sort_connections_by_source_ );
+
+  // NUMA node of the first connector of each thread
+  std::vector< long > connection_numa_nodes( connections_.size(), -1 );
+  for ( thread tid = 0; tid < static_cast< thread >( connections_.size() );
+        ++tid )
+  {
+    for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+    {
+      if ( connections_[ tid ][ syn_id ] != NULL )
+      {
+        connection_numa_nodes[ tid ] =
+          numa_node_of_address( connections_[ tid ][ syn_id ] );
+        break;
+      }
+    }
+  }
+  ArrayDatum connection_numa_nodes_ad( connection_numa_nodes );
+  def< ArrayDatum >(
+    dict, names::connection_numa_nodes, connection_numa_nodes_ad );
 }
 
 DictionaryDatum
@@ -525,6 +568,126 @@ nest::ConnectionManager::connect( const index sgid,
   }
 }
 
+void
+nest::ConnectionManager::connect_bulk( const thread tid,
+  const synindex syn_id,
+  const std::vector< index >& sgids,
+  const std::vector< Node* >& targets,
+  const std::vector< double >& delays,
+  const std::vector< double >& weights )
+{
+  assert( sgids.size() == targets.size() );
+  assert( sgids.size() == delays.size() );
+  assert( sgids.size() == weights.size() );
+
+  if ( sgids.empty() )
+  {
+    return;
+  }
+
+  kernel().model_manager.assert_valid_syn_id( syn_id );
+
+  have_connections_changed_ = true;
+
+  ConnectorModel& synapse_prototype =
+    kernel().model_manager.get_synapse_prototype( syn_id, tid );
+  const bool is_primary = synapse_prototype.is_primary();
+
+  if ( num_connections_[ tid ].size() <= syn_id )
+  {
+    num_connections_[ tid ].resize( syn_id + 1 );
+  }
+
+  // empty parameter dictionary shared by all connections involving devices
+  const DictionaryDatum params( new Dictionary );
+
+  std::vector< Node* > sources( sgids.size() );
+  for ( size_t i = 0; i < sgids.size(); ++i )
+  {
+    sources[ i ] = kernel().node_manager.get_node( sgids[ i ], tid );
+  }
+
+  size_t begin = 0;
+  while ( begin < sgids.size() )
+  {
+    // find the run of connections between nodes with proxies starting here
+    size_t end = begin;
+    while ( end < sgids.size() and sources[ end ]->has_proxies()
+      and targets[ end ]->has_proxies() )
+    {
+      ++end;
+    }
+
+    if ( end == begin )
+    {
+      // connections from or to devices without proxies
+      connect( sgids[ begin ],
+        targets[ begin ],
+        tid,
+        syn_id,
+        params,
+        delays[ begin ],
+        weights[ begin ] );
+      ++begin;
+      continue;
+    }
+
+    const size_t num_before = connections_[ tid ][ syn_id ] == NULL
+      ? 0
+      : connections_[ tid ][ syn_id ]->size();
+    try
+    {
+      synapse_prototype.add_connections( sources,
+        targets,
+        connections_[ tid ],
+        syn_id,
+        delays,
+        weights,
+        begin,
+        end );
+    }
+    catch ( ... )
+    {
+      // count the connections created before the exception
+      add_bulk_sources_( tid, syn_id, sgids, begin, num_before, is_primary );
+      throw;
+    }
+    add_bulk_sources_( tid, syn_id, sgids, begin, num_before, is_primary );
+
+    begin = end;
+  }
+}
+
+void
+nest::ConnectionManager::add_bulk_sources_( const thread tid,
+  const synindex syn_id,
+  const std::vector< index >& sgids,
+  const size_t begin,
+  const size_t num_before,
+  const bool is_primary )
+{
+  const size_t num_created = connections_[ tid ][ syn_id ] == NULL
+    ? 0
+    : connections_[ tid ][ syn_id ]->size() - num_before;
+  if ( num_created == 0 )
+  {
+    return;
+  }
+
+  source_table_.add_sources(
+    tid, syn_id, sgids, begin, begin + num_created, is_primary );
+  num_connections_[ tid ][ syn_id ] += num_created;
+
+  if ( is_primary )
+  {
+    has_primary_connections_ = true;
+  }
+  else
+  {
+    secondary_connections_exist_ = true;
+  }
+}
+
 // gid gid dict syn_id
 bool
 nest::ConnectionManager::connect( const index sgid,
@@ -693,23 +856,26 @@ nest::ConnectionManager::find_connection( const thread tid,
   const index sgid,
   const index tgid )
 {
-  // lcid will hold the position of the /first/ connection from node
-  // sgid to any local node, or be invalid
-  index lcid = source_table_.find_first_source( tid, syn_id, sgid );
-  if ( lcid == invalid_index )
-  {
-    return invalid_index;
-  }
-
-  // lcid will hold the position of the /first/ connection from node
-  // sgid to node tgid, or be invalid
-  lcid = connections_[ tid ][ syn_id ]->find_first_target( tid, lcid, tgid );
-  if ( lcid != invalid_index )
-  {
-    return lcid;
+  // first_lcids will hold the positions of the /first/ connection from
+  // node sgid to any local node in each sorted segment of the source table
+  std::vector< index > first_lcids;
+  source_table_.find_first_sources( tid, syn_id, sgid, first_lcids );
+
+  for ( std::vector< index >::const_iterator it = first_lcids.begin();
+        it != first_lcids.end();
+        ++it )
+  {
+    // lcid will hold the position of the /first/ connection from node
+    // sgid to node tgid in this segment, or be invalid
+    const index lcid =
+      connections_[ tid ][ syn_id ]->find_first_target( tid, *it, tgid );
+    if ( lcid != invalid_index )
+    {
+      return lcid;
+    }
   }
 
-  return lcid;
+  return invalid_index;
 }
 
 void
@@ -730,8 +896,11 @@ nest::ConnectionManager::disconnect( const thread tid,
     throw InexistentConnection();
   }
 
+  // the disabled connection keeps its lcid until the connection
+  // infrastructure is rebuilt, so that incremental updates remain possible
   connections_[ tid ][ syn_id ]->disable_connection( lcid );
   source_table_.disable_connection( tid, syn_id, lcid );
+  ++num_disabled_connections_[ tid ];
 
   --num_connections_[ tid ][ syn_id ];
 }
@@ -1416,16 +1585,19 @@ nest::ConnectionManager::get_targets( const std::vector< index >& sources,
     ( *i ).clear();
   }
 
+  std::vector< index > start_lcids;
   for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
   {
     for ( size_t i = 0; i < sources.size(); ++i )
     {
-      const index start_lcid =
-        source_table_.find_first_source( tid, syn_id, sources[ i ] );
-      if ( start_lcid != invalid_index )
+      source_table_.find_first_sources(
+        tid, syn_id, sources[ i ], start_lcids );
+      for ( std::vector< index >::const_iterator it = start_lcids.begin();
+            it != start_lcids.end();
+            ++it )
       {
         connections_[ tid ][ syn_id ]->get_target_gids(
-          tid, start_lcid, post_synaptic_element, targets[ i ] );
+          tid, *it, post_synaptic_element, targets[ i ] );
       }
     }
   }
@@ -1435,6 +1607,11 @@ void
 nest::ConnectionManager::sort_connections( const thread tid )
 {
   assert( not source_table_.is_cleared() );
+  source_table_.reset_segments( tid );
+  for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+  {
+    source_table_.disable_pending_sources( tid, syn_id, 0 );
+  }
   if ( sort_connections_by_source_ )
   {
     for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
@@ -1449,6 +1626,55 @@ nest::ConnectionManager::sort_connections( const thread tid )
   }
 }
 
+void
+nest::ConnectionManager::sort_new_connections( const thread tid )
+{
+  assert( not source_table_.is_cleared() );
+  assert( sort_connections_by_source_ );
+  for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+  {
+    if ( connections_[ tid ][ syn_id ] != NULL )
+    {
+      const index first = source_table_.start_new_segment( tid, syn_id );
+      // connections disabled in the new segment are sorted to its end,
+      // those in older segments keep their positions
+      source_table_.disable_pending_sources( tid, syn_id, first );
+      connections_[ tid ][ syn_id ]->sort_connections(
+        source_table_.get_thread_local_sources( tid )[ syn_id ], first );
+    }
+  }
+}
+
+void
+nest::ConnectionManager::check_incremental_update()
+{
+  const size_t num_connections = get_num_connections();
+  const size_t num_disabled = std::accumulate(
+    num_disabled_connections_.begin(), num_disabled_connections_.end(), 0UL );
+
+  // disabled connections are still stored, so the number of connections
+  // created since the last full update follows from the stored ones
+  const size_t num_created =
+    num_connections + num_disabled - num_connections_full_update_;
+  const bool incremental_possible = keep_source_table_
+    and sort_connections_by_source_ and not needs_full_update_
+    and not secondary_connections_exist_
+    and not kernel().node_manager.have_nodes_changed()
+    and num_connections + num_disabled >= num_connections_full_update_
+    and num_created + num_disabled
+      <= max_incremental_fraction_ * num_connections_full_update_;
+
+  incremental_update_ =
+    not kernel().mpi_manager.any_true( not incremental_possible );
+
+  if ( not incremental_update_ )
+  {
+    num_connections_full_update_ = num_connections;
+    num_disabled_connections_.assign( num_disabled_connections_.size(), 0 );
+    needs_full_update_ = false;
+  }
+}
+
 void
 nest::ConnectionManager::compute_target_data_buffer_size()
 {
@@ -1654,13 +1880,15 @@ nest::ConnectionManager::resize_connections()
 {
   kernel().vp_manager.assert_single_threaded();
 
-  // Resize data structures for connections between neurons
-  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  // Resize data structures for connections between neurons on the thread
+  // owning them, so that their memory is placed close to it
+#pragma omp parallel
   {
+    const thread tid = kernel().vp_manager.get_thread_id();
     connections_[ tid ].resize(
       kernel().model_manager.get_num_synapse_prototypes() );
     source_table_.resize_sources( tid );
-  }
+  } // of omp parallel
 
   // Resize data structures for connections between neurons and
   // devices
@@ -124,6 +124,26 @@ public:
     const double_t delay = numerics::nan,
     const double_t weight = numerics::nan );
 
+  /**
+   * Create connections from the nodes sgids[ i ] to targets[ i ] with
+   * delays[ i ] and weights[ i ] on thread tid, which must host all targets.
+   * Delays and weights can be numerics::nan to use the defaults of the
+   * synapse model. All connections are created without further synapse
+   * parameters.
+   *
+   * The result is the same as calling connect() for each connection in
+   * order, but the synapse prototype is looked up only once, no parameter
+   * dictionary is created per connection, and runs of connections between
+   * nodes with proxies are appended to the Connector and the SourceTable in
+   * one step each.
+   */
+  void connect_bulk( const thread tid,
+    const synindex syn_id,
+    const std::vector< index >& sgids,
+    const std::vector< Node* >& targets,
+    const std::vector< double >& delays,
+    const std::vector< double >& weights );
+
   /**
    * Connect two nodes. The source and target nodes are defined by their
    * global ID. The connection is established on the thread/process that owns
@@ -270,6 +290,17 @@ public:
     const std::vector< ConnectorModel* >& cm,
     Event& e );
 
+  /**
+   * Deliver a batch of spikes to connections of synapse type syn_id.
+   * @see ConnectorBase::send_batch
+   */
+  void send_batch( const thread tid,
+    const synindex syn_id,
+    const std::vector< ConnectorModel* >& cm,
+    const SpikeBatch& batch,
+    const std::vector< Time >& stamps,
+    SpikeEvent& e );
+
   /**
    * Send event e to all device targets of source source_gid
    */
@@ -349,6 +380,36 @@ public:
    */
   void sort_connections( const thread tid );
 
+  /**
+   * Sorts connections created since the last update of the connection
+   * infrastructure by increasing source gid. These connections form a
+   * new sorted segment behind the existing connections, which keep
+   * their positions, so that the targets on the presynaptic side
+   * remain valid.
+   */
+  void sort_new_connections( const thread tid );
+
+  /**
+   * Decides whether the connection infrastructure can be updated
+   * incrementally, i.e., whether it suffices to sort and communicate
+   * the connections created since the last update. This requires that
+   * the source table is kept and sorted, that no nodes were created, and
+   * neither keep_source_table nor sort_connections_by_source changed
+   * since the last update, that no secondary connections exist, and that
+   * the number of connections created or deleted since the last full
+   * update is small compared to the number of connections at that
+   * update. Deleted connections are disabled and keep their positions
+   * until the next full update. The decision is the same on all
+   * processes. Must be called by a single thread.
+   */
+  void check_incremental_update();
+
+  /**
+   * Returns true if the current update of the connection infrastructure
+   * is incremental, see check_incremental_update().
+   */
+  bool is_incremental_update() const;
+
   /**
    * Removes disabled connections (of structural plasticity)
    */
@@ -489,6 +550,20 @@ private:
     const double delay = numerics::nan,
     const double weight = numerics::nan );
 
+  /**
+   * Adds the sources of the connections that the last call of
+   * ConnectorModel::add_connections() appended to the connector of syn_id on
+   * thread tid, which held num_before connections before the call, to the
+   * SourceTable and counts the connections. The first of these connections
+   * has the source sgids[ begin ].
+   */
+  void add_bulk_sources_( const thread tid,
+    const synindex syn_id,
+    const std::vector< index >& sgids,
+    const size_t begin,
+    const size_t num_before,
+    const bool is_primary );
+
   /**
    * connect_to_device_ is used to establish a connection between a sender and
    * receiving node if the sender has proxies, and the receiver does not.
@@ -618,6 +693,32 @@ private:
   //! Whether to sort connections by source gid.
   bool sort_connections_by_source_;
 
+  //! True if the handling of the source table has changed since the last
+  //! full update of the connection infrastructure.
+  bool needs_full_update_;
+
+  //! Whether the current update of the connection infrastructure is
+  //! incremental.
+  bool incremental_update_;
+
+  //! Number of connections at the last full update of the connection
+  //! infrastructure.
+  size_t num_connections_full_update_;
+
+  //! Number of connections disabled on each thread since the last full
+  //! update of the connection infrastructure, which are still stored.
+  std::vector< size_t > num_disabled_connections_;
+
+  /**
+   * Maximal number of connections created or deleted since the last full
+   * update of the connection infrastructure, relative to the number of
+   * connections at that update, for which the next update is incremental.
+   * Beyond, the connection infrastructure is rebuilt to merge all
+   * connections into a single sorted table and to remove disabled
+   * connections.
+   */
+  static const double max_incremental_fraction_;
+
   //! Whether primary connections (spikes) exist.
   bool has_primary_connections_;
 
@@ -806,6 +907,12 @@ ConnectionManager::secondary_connections_exist() const
   return secondary_connections_exist_;
 }
 
+inline bool
+ConnectionManager::is_incremental_update() const
+{
+  return incremental_update_;
+}
+
 inline bool
 ConnectionManager::get_sort_connections_by_source() const
 {
@@ -836,6 +943,17 @@ ConnectionManager::send( const thread tid,
   connections_[ tid ][ syn_id ]->send( tid, lcid, cm, e );
 }
 
+inline void
+ConnectionManager::send_batch( const thread tid,
+  const synindex syn_id,
+  const std::vector< ConnectorModel* >& cm,
+  const SpikeBatch& batch,
+  const std::vector< Time >& stamps,
+  SpikeEvent& e )
+{
+  connections_[ tid ][ syn_id ]->send_batch( tid, cm, batch, stamps, e );
+}
+
 inline void
 ConnectionManager::restructure_connection_tables( const thread tid )
 {
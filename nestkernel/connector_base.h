@@ -44,6 +44,7 @@
 #include "nest_names.h"
 #include "node.h"
 #include "source.h"
+#include "spike_batch.h"
 #include "spikecounter.h"
 
 // Includes from sli:
@@ -156,6 +157,18 @@ public:
     const std::vector< ConnectorModel* >& cm,
     Event& e ) = 0;
 
+  /**
+   * Deliver a batch of spikes of this synapse type. For each spike, the
+   * event e is sent to all connections of its source, starting at the
+   * lcid given in the batch. The time stamp of each spike is looked up
+   * in stamps by its lag.
+   */
+  virtual void send_batch( const thread tid,
+    const std::vector< ConnectorModel* >& cm,
+    const SpikeBatch& batch,
+    const std::vector< Time >& stamps,
+    SpikeEvent& e ) = 0;
+
   virtual void send_weight_event( const thread tid,
     const unsigned int lcid,
     Event& e,
@@ -171,10 +184,19 @@ public:
     const std::vector< ConnectorModel* >& cm ) = 0;
 
   /**
-   * Sort connections according to source gids.
+   * Sort connections according to source gids. Connections appended to
+   * an already sorted table are merged into it, see nest::sort().
    */
   virtual void sort_connections( BlockVector< Source >& ) = 0;
 
+  /**
+   * Sort connections from position first on according to source gids,
+   * without moving the connections in front of first, see
+   * nest::sort_from().
+   */
+  virtual void sort_connections( BlockVector< Source >&,
+    const index first ) = 0;
+
   /**
    * Set a flag in the connection indicating whether the following
    * connection belongs to the same source.
@@ -224,6 +246,23 @@ private:
   BlockVector< ConnectionT > C_;
   const synindex syn_id_;
 
+  /**
+   * Number of spikes by which the connections of upcoming spikes are
+   * prefetched in send_batch().
+   */
+  static const size_t prefetch_distance_ = 4;
+
+  /**
+   * Hint to load the connection at position lcid into the cache.
+   */
+  void
+  prefetch_( const index lcid ) const
+  {
+#ifdef __GNUC__
+    __builtin_prefetch( &C_[ lcid ] );
+#endif
+  }
+
 public:
   explicit Connector( const synindex syn_id )
     : syn_id_( syn_id )
@@ -280,6 +319,16 @@ public:
     return *this;
   }
 
+  /**
+   * Appends the connections in the range [first, last).
+   */
+  template < typename ForwardIt >
+  void
+  push_back( ForwardIt first, ForwardIt last )
+  {
+    C_.append( first, last );
+  }
+
   void
   get_connection( const index source_gid,
     const index target_gid,
@@ -413,6 +462,62 @@ public:
     return 1 + lcid_offset; // event was delivered to at least one target
   }
 
+  void
+  send_batch( const thread tid,
+    const std::vector< ConnectorModel* >& cm,
+    const SpikeBatch& batch,
+    const std::vector< Time >& stamps,
+    SpikeEvent& e )
+  {
+    // common properties are the same for all spikes in the batch
+    typename ConnectionT::CommonPropertiesType const& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )
+        ->get_common_properties();
+    const bool has_weight_recorder = cp.get_weight_recorder() != 0;
+
+    const size_t num_spikes = batch.size();
+    for ( size_t i = 0; i < prefetch_distance_ and i < num_spikes; ++i )
+    {
+      prefetch_( batch.get_lcid( i ) );
+    }
+
+    for ( size_t i = 0; i < num_spikes; ++i )
+    {
+      if ( i + prefetch_distance_ < num_spikes )
+      {
+        prefetch_( batch.get_lcid( i + prefetch_distance_ ) );
+      }
+
+      e.set_stamp( stamps[ batch.get_lag( i ) ] );
+      e.set_offset( batch.get_offset( i ) );
+      e.set_sender_gid( batch.get_source_gid( i ) );
+
+      // connections of the same source are stored contiguously
+      index lcid = batch.get_lcid( i );
+      while ( true )
+      {
+        ConnectionT& conn = C_[ lcid ];
+        const bool has_source_subsequent_targets =
+          conn.has_source_subsequent_targets();
+
+        e.set_port( lcid );
+        if ( not conn.is_disabled() )
+        {
+          conn.send( e, tid, cp );
+          if ( has_weight_recorder )
+          {
+            send_weight_event( tid, lcid, e, cp );
+          }
+        }
+        if ( not has_source_subsequent_targets )
+        {
+          break;
+        }
+        ++lcid;
+      }
+    }
+  }
+
   // Implemented in connector_base_impl.h
   void send_weight_event( const thread tid,
     const unsigned int lcid,
@@ -447,6 +552,12 @@ public:
     nest::sort( sources, C_ );
   }
 
+  void
+  sort_connections( BlockVector< Source >& sources, const index first )
+  {
+    nest::sort_from( sources, C_, first );
+  }
+
   void
   set_has_source_subsequent_targets( const index lcid,
     const bool has_subsequent_targets )
@@ -83,6 +83,25 @@ public:
     const double delay = NAN,
     const double weight = NAN ) = 0;
 
+  /**
+   * Adds the connections from sources[ i ] to targets[ i ] with delays[ i ]
+   * and weights[ i ] for begin <= i < end, without further synapse
+   * parameters.
+   *
+   * The result is the same as calling add_connection() for each connection
+   * with an empty parameter dictionary, but all connections are appended to
+   * the Connector in one step. If a connection fails its checks, the
+   * connections before it are added and the exception is rethrown.
+   */
+  virtual void add_connections( const std::vector< Node* >& sources,
+    const std::vector< Node* >& targets,
+    std::vector< ConnectorBase* >& hetconn,
+    const synindex syn_id,
+    const std::vector< double >& delays,
+    const std::vector< double >& weights,
+    const size_t begin,
+    const size_t end ) = 0;
+
   virtual ConnectorModel* clone( std::string ) const = 0;
 
   virtual void calibrate( const TimeConverter& tc ) = 0;
@@ -194,6 +213,15 @@ public:
     const double delay,
     const double weight );
 
+  void add_connections( const std::vector< Node* >& sources,
+    const std::vector< Node* >& targets,
+    std::vector< ConnectorBase* >& hetconn,
+    const synindex syn_id,
+    const std::vector< double >& delays,
+    const std::vector< double >& weights,
+    const size_t begin,
+    const size_t end );
+
   ConnectorModel* clone( std::string ) const;
 
   void calibrate( const TimeConverter& tc );
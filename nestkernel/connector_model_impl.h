@@ -261,6 +261,73 @@ GenericConnectorModel< ConnectionT >::add_connection( Node& src,
     actual_receptor_type );
 }
 
+template < typename ConnectionT >
+void
+GenericConnectorModel< ConnectionT >::add_connections(
+  const std::vector< Node* >& sources,
+  const std::vector< Node* >& targets,
+  std::vector< ConnectorBase* >& thread_local_connectors,
+  const synindex syn_id,
+  const std::vector< double >& delays,
+  const std::vector< double >& weights,
+  const size_t begin,
+  const size_t end )
+{
+  assert( syn_id != invalid_synindex );
+
+  if ( thread_local_connectors[ syn_id ] == NULL )
+  {
+    thread_local_connectors[ syn_id ] = new Connector< ConnectionT >( syn_id );
+  }
+  Connector< ConnectionT >* connector =
+    static_cast< Connector< ConnectionT >* >(
+      thread_local_connectors[ syn_id ] );
+
+  std::vector< ConnectionT > connections;
+  connections.reserve( end - begin );
+
+  try
+  {
+    for ( size_t i = begin; i < end; ++i )
+    {
+      if ( numerics::is_nan( delays[ i ] ) )
+      {
+        used_default_delay();
+      }
+      else if ( has_delay_ )
+      {
+        kernel().connection_manager.get_delay_checker().assert_valid_delay_ms(
+          delays[ i ] );
+      }
+
+      ConnectionT connection = ConnectionT( default_connection_ );
+
+      if ( not numerics::is_nan( weights[ i ] ) )
+      {
+        connection.set_weight( weights[ i ] );
+      }
+
+      if ( not numerics::is_nan( delays[ i ] ) )
+      {
+        connection.set_delay( delays[ i ] );
+      }
+
+      // The following line will throw an exception, if it does not work.
+      connection.check_connection(
+        *sources[ i ], *targets[ i ], receptor_type_, get_common_properties() );
+
+      connections.push_back( connection );
+    }
+  }
+  catch ( ... )
+  {
+    // keep the connections checked so far, as add_connection() would have
+    connector->push_back( connections.begin(), connections.end() );
+    throw;
+  }
+
+  connector->push_back( connections.begin(), connections.end() );
+}
 
 template < typename ConnectionT >
 void
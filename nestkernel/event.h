@@ -45,6 +45,7 @@ namespace nest
 {
 
 class Node;
+class SamplingBuffer;
 
 /**
  * Encapsulates information which is sent between Nodes.
@@ -592,6 +593,17 @@ public:
   /** Access to vector of recordables. */
   const std::vector< Name >& record_from() const;
 
+  /**
+   * Set buffer into which data loggers shall write their samples.
+   * If a request carrying a buffer is used to connect a multimeter to a
+   * node, the data logger of the node writes to the buffer instead of
+   * answering DataLoggingRequests during simulation.
+   */
+  void set_sampling_buffer( SamplingBuffer* );
+
+  /** Access to buffer for samples, 0 if none is provided. */
+  SamplingBuffer* get_sampling_buffer() const;
+
 private:
   //! Interval between two recordings, first is step 1
   Time recording_interval_;
@@ -604,6 +616,9 @@ private:
    * routine.
    */
   std::vector< Name > const* const record_from_;
+
+  //! Buffer provided by the multimeter for direct sampling
+  SamplingBuffer* sampling_buffer_;
 };
 
 inline DataLoggingRequest::DataLoggingRequest()
@@ -611,6 +626,7 @@ inline DataLoggingRequest::DataLoggingRequest()
   , recording_interval_( Time::neg_inf() )
   , recording_offset_( Time::ms( 0. ) )
   , record_from_( 0 )
+  , sampling_buffer_( 0 )
 {
 }
 
@@ -619,6 +635,7 @@ inline DataLoggingRequest::DataLoggingRequest( const Time& rec_int,
   : Event()
   , recording_interval_( rec_int )
   , record_from_( &recs )
+  , sampling_buffer_( 0 )
 {
 }
 
@@ -629,6 +646,7 @@ inline DataLoggingRequest::DataLoggingRequest( const Time& rec_int,
   , recording_interval_( rec_int )
   , recording_offset_( rec_offset )
   , record_from_( &recs )
+  , sampling_buffer_( 0 )
 {
 }
 
@@ -666,6 +684,18 @@ DataLoggingRequest::record_from() const
   return *record_from_;
 }
 
+inline void
+DataLoggingRequest::set_sampling_buffer( SamplingBuffer* buffer )
+{
+  sampling_buffer_ = buffer;
+}
+
+inline SamplingBuffer*
+DataLoggingRequest::get_sampling_buffer() const
+{
+  return sampling_buffer_;
+}
+
 /**
  * Provide logged data through request transmitting reference.
  * @see DataLoggingRequest
@@ -23,9 +23,9 @@
 #include "event_delivery_manager.h"
 
 // C++ includes:
-#include <algorithm> // rotate
+#include <algorithm> // max_element, min, rotate, sort
 #include <iostream>
-#include <numeric> // accumulate
+#include <numeric> // accumulate, partial_sum
 
 // Includes from libnestutil:
 #include "logging.h"
@@ -48,6 +48,9 @@ namespace nest
 {
 EventDeliveryManager::EventDeliveryManager()
   : off_grid_spiking_( false )
+  , overlap_spike_communication_( false )
+  , compress_spike_data_( false )
+  , spike_data_exchange_pending_( false )
   , moduli_()
   , slice_moduli_()
   , spike_register_()
@@ -57,8 +60,20 @@ EventDeliveryManager::EventDeliveryManager()
   , time_collocate_( 0.0 )
   , time_communicate_( 0.0 )
   , local_spike_counter_()
+  , spike_buffer_positions_()
+  , sorted_spike_buffer_positions_()
+  , syn_id_offsets_()
+  , spike_batches_()
+  , max_num_spike_data_per_rank_()
+  , is_spike_send_partner_()
+  , is_spike_recv_partner_()
   , send_buffer_spike_data_()
   , recv_buffer_spike_data_()
+  , send_buffer_compressed_spike_data_()
+  , recv_buffer_compressed_spike_data_()
+  , send_counts_compressed_spike_data_()
+  , recv_counts_compressed_spike_data_()
+  , spike_data_runs_()
   , send_buffer_off_grid_spike_data_()
   , recv_buffer_off_grid_spike_data_()
   , send_buffer_target_data_()
@@ -83,9 +98,22 @@ EventDeliveryManager::initialize()
   reset_timers_counters();
   spike_register_.resize( num_threads );
   off_grid_spike_register_.resize( num_threads );
+  spike_buffer_positions_.resize( num_threads );
+  sorted_spike_buffer_positions_.resize( num_threads );
+  syn_id_offsets_.resize( num_threads );
+  spike_batches_.resize( num_threads );
+  max_num_spike_data_per_rank_.resize( num_threads, 0 );
+  spike_data_runs_.resize( num_threads );
+  is_spike_send_partner_.assign(
+    kernel().mpi_manager.get_num_processes(), false );
+  is_spike_recv_partner_.assign(
+    kernel().mpi_manager.get_num_processes(), false );
   gather_completed_checker_.resize( num_threads, false );
   // Ensures that ResetKernel resets off_grid_spiking_
   off_grid_spiking_ = false;
+  overlap_spike_communication_ = false;
+  compress_spike_data_ = false;
+  spike_data_exchange_pending_ = false;
   buffer_size_target_data_has_changed_ = false;
   buffer_size_spike_data_has_changed_ = false;
 
@@ -103,6 +131,9 @@ EventDeliveryManager::initialize()
       std::vector< std::vector< OffGridTarget > >(
         kernel().connection_manager.get_min_delay(),
         std::vector< OffGridTarget >() ) );
+
+    spike_buffer_positions_[ tid ].resize(
+      num_threads, std::vector< size_t >() );
   } // of omp parallel
 }
 
@@ -114,6 +145,15 @@ EventDeliveryManager::finalize()
     spike_register_ );
   std::vector< std::vector< std::vector< std::vector< OffGridTarget > > > >()
     .swap( off_grid_spike_register_ );
+  std::vector< std::vector< std::vector< size_t > > >().swap(
+    spike_buffer_positions_ );
+  std::vector< std::vector< size_t > >().swap(
+    sorted_spike_buffer_positions_ );
+  std::vector< std::vector< size_t > >().swap( syn_id_offsets_ );
+  std::vector< SpikeBatch >().swap( spike_batches_ );
+  max_num_spike_data_per_rank_.clear();
+  is_spike_send_partner_.clear();
+  is_spike_recv_partner_.clear();
   gather_completed_checker_.clear();
 
   send_buffer_secondary_events_.clear();
@@ -122,18 +162,36 @@ EventDeliveryManager::finalize()
   recv_buffer_spike_data_.clear();
   send_buffer_off_grid_spike_data_.clear();
   recv_buffer_off_grid_spike_data_.clear();
+  send_buffer_compressed_spike_data_.clear();
+  recv_buffer_compressed_spike_data_.clear();
+  send_counts_compressed_spike_data_.clear();
+  recv_counts_compressed_spike_data_.clear();
+  std::vector< std::vector< std::pair< unsigned int, unsigned int > > >()
+    .swap( spike_data_runs_ );
 }
 
 void
 EventDeliveryManager::set_status( const DictionaryDatum& dict )
 {
   updateValue< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  updateValue< bool >( dict,
+    names::overlap_spike_communication,
+    overlap_spike_communication_ );
+  if ( updateValue< bool >(
+         dict, names::compress_spike_data, compress_spike_data_ ) )
+  {
+    resize_send_recv_buffers_spike_data_();
+  }
 }
 
 void
 EventDeliveryManager::get_status( DictionaryDatum& dict )
 {
   def< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  def< bool >( dict,
+    names::overlap_spike_communication,
+    overlap_spike_communication_ );
+  def< bool >( dict, names::compress_spike_data, compress_spike_data_ );
   def< double >( dict, names::time_collocate, time_collocate_ );
   def< double >( dict, names::time_communicate, time_communicate_ );
   def< unsigned long >(
@@ -170,6 +228,26 @@ EventDeliveryManager::resize_send_recv_buffers_spike_data_()
     kernel().mpi_manager.get_buffer_size_spike_data() );
   recv_buffer_off_grid_spike_data_.resize(
     kernel().mpi_manager.get_buffer_size_spike_data() );
+
+  // only allocate compressed buffers if they are used
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+  const size_t compressed_buffer_size =
+    compress_spike_data_
+    ? num_processes * get_compressed_chunk_size_spike_data_()
+    : 0;
+  send_buffer_compressed_spike_data_.resize( compressed_buffer_size );
+  recv_buffer_compressed_spike_data_.resize( compressed_buffer_size );
+  send_counts_compressed_spike_data_.resize( num_processes, 0 );
+  recv_counts_compressed_spike_data_.resize( num_processes, 0 );
+}
+
+size_t
+EventDeliveryManager::get_compressed_chunk_size_spike_data_() const
+{
+  // one header entry, and at most one key, one length and one local
+  // connection ID per spike
+  return 1
+    + 3 * kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
 }
 
 void
@@ -337,12 +415,125 @@ EventDeliveryManager::gather_spike_data( const thread tid )
   }
 }
 
+void
+EventDeliveryManager::start_gather_spike_data( const thread tid,
+  const delay max_lag )
+{
+  if ( off_grid_spiking_ )
+  {
+    start_gather_spike_data_( tid,
+      max_lag,
+      send_buffer_off_grid_spike_data_,
+      recv_buffer_off_grid_spike_data_ );
+  }
+  else
+  {
+    start_gather_spike_data_(
+      tid, max_lag, send_buffer_spike_data_, recv_buffer_spike_data_ );
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::start_gather_spike_data_( const thread tid,
+  const delay max_lag,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  const AssignedRanks assigned_ranks =
+    kernel().vp_manager.get_assigned_ranks( tid );
+
+// Apply a change of the buffer size requested at the end of the
+// previous gather.
+#pragma omp single
+  {
+    if ( kernel().mpi_manager.adaptive_spike_buffers()
+      and buffer_size_spike_data_has_changed_ )
+    {
+      resize_send_recv_buffers_spike_data_();
+      buffer_size_spike_data_has_changed_ = false;
+    }
+  } // of omp single; implicit barrier
+
+  SendBufferPosition send_buffer_position( assigned_ranks,
+    kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
+
+  // Only a single round of communication is performed here; spikes
+  // that do not fit into the send buffer are left in the register
+  // and communicated by gather_spike_data_.
+  collocate_spike_data_buffers_( tid,
+    assigned_ranks,
+    send_buffer_position,
+    spike_register_,
+    send_buffer,
+    max_lag );
+
+  if ( off_grid_spiking_ )
+  {
+    collocate_spike_data_buffers_( tid,
+      assigned_ranks,
+      send_buffer_position,
+      off_grid_spike_register_,
+      send_buffer,
+      max_lag );
+  }
+
+#pragma omp barrier
+  set_end_and_invalid_markers_(
+    assigned_ranks, send_buffer_position, send_buffer );
+  clean_spike_register_( tid );
+#pragma omp barrier
+
+// Start communication using a single thread, all other threads can
+// immediately continue with the update of nodes.
+#pragma omp single nowait
+  {
+    if ( off_grid_spiking_ )
+    {
+      kernel().mpi_manager.communicate_off_grid_spike_data_Ialltoall(
+        send_buffer, recv_buffer );
+    }
+    else
+    {
+      kernel().mpi_manager.communicate_spike_data_Ialltoall(
+        send_buffer, recv_buffer );
+    }
+    spike_data_exchange_pending_ = true;
+  } // of omp single nowait
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::complete_gather_spike_data_( const thread tid,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+#pragma omp single
+  {
+    kernel().mpi_manager.wait_Ialltoall();
+  } // of omp single; implicit barrier
+
+  // completion markers are not used for the non-blocking exchange,
+  // since remaining spikes are communicated by gather_spike_data_
+  deliver_events_( tid, recv_buffer );
+#pragma omp barrier
+
+#pragma omp single
+  {
+    spike_data_exchange_pending_ = false;
+  } // of omp single; implicit barrier
+}
+
 template < typename SpikeDataT >
 void
 EventDeliveryManager::gather_spike_data_( const thread tid,
   std::vector< SpikeDataT >& send_buffer,
   std::vector< SpikeDataT >& recv_buffer )
 {
+  if ( spike_data_exchange_pending_ )
+  {
+    complete_gather_spike_data_( tid, recv_buffer );
+  }
+
   // Assume all threads have some work to do
   gather_completed_checker_.set( tid, false );
   assert( gather_completed_checker_.all_false() );
@@ -371,8 +562,12 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
       kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
 
     // Collocate spikes to send buffer
-    const bool collocate_completed = collocate_spike_data_buffers_(
-      tid, assigned_ranks, send_buffer_position, spike_register_, send_buffer );
+    const bool collocate_completed = collocate_spike_data_buffers_( tid,
+      assigned_ranks,
+      send_buffer_position,
+      spike_register_,
+      send_buffer,
+      kernel().connection_manager.get_min_delay() );
     gather_completed_checker_.logical_and( tid, collocate_completed );
 
     if ( off_grid_spiking_ )
@@ -382,10 +577,13 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
           assigned_ranks,
           send_buffer_position,
           off_grid_spike_register_,
-          send_buffer );
+          send_buffer,
+          kernel().connection_manager.get_min_delay() );
       gather_completed_checker_.logical_and(
         tid, collocate_completed_off_grid );
     }
+    max_num_spike_data_per_rank_[ tid ] =
+      send_buffer_position.get_max_num_entries();
 
 #pragma omp barrier
     // Set markers to signal end of valid spikes, and remove spikes
@@ -396,7 +594,8 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
 
     // If we do not have any spikes left, set corresponding marker in
     // send buffer.
-    if ( gather_completed_checker_.all_true() )
+    const bool collocate_completed_all = gather_completed_checker_.all_true();
+    if ( collocate_completed_all )
     {
       // Needs to be called /after/ set_end_and_invalid_markers_.
       set_complete_marker_spike_data_(
@@ -404,10 +603,29 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
 #pragma omp barrier
     }
 
+    // Off-grid spikes are always sent in the uncompressed format.
+    const bool compress = compress_spike_data_ and not off_grid_spiking_;
+    if ( compress )
+    {
+      compress_spike_data_buffer_( tid, assigned_ranks, send_buffer );
+#pragma omp barrier
+    }
+
 // Communicate spikes using a single thread.
 #pragma omp single
     {
-      if ( off_grid_spiking_ )
+      Stopwatch sw_communicate;
+      sw_communicate.start();
+      if ( compress )
+      {
+        kernel().mpi_manager.communicate_compressed_spike_data_Alltoallv(
+          send_buffer_compressed_spike_data_,
+          send_counts_compressed_spike_data_,
+          recv_buffer_compressed_spike_data_,
+          recv_counts_compressed_spike_data_,
+          get_compressed_chunk_size_spike_data_() );
+      }
+      else if ( off_grid_spiking_ )
       {
         kernel().mpi_manager.communicate_off_grid_spike_data_Alltoall(
           send_buffer, recv_buffer );
@@ -417,26 +635,44 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
         kernel().mpi_manager.communicate_spike_data_Alltoall(
           send_buffer, recv_buffer );
       }
+      sw_communicate.stop();
+      time_communicate_ += sw_communicate.elapsed();
+
+      if ( kernel().mpi_manager.sparse_spike_exchange() and not compress )
+      {
+        // Ranks that are not connected to this rank did not send their
+        // completion markers, so completion is determined globally.
+        std::vector< long > incomplete( 1, not collocate_completed_all );
+        kernel().mpi_manager.communicate_Allreduce_max_in_place( incomplete );
+        set_markers_of_silent_ranks_( recv_buffer, incomplete[ 0 ] == 0 );
+      }
     } // of omp single; implicit barrier
 
+    if ( compress )
+    {
+      decompress_spike_data_buffer_( assigned_ranks, recv_buffer );
+#pragma omp barrier
+    }
+
     // Deliver spikes from receive buffer to ring buffers.
     const bool deliver_completed = deliver_events_( tid, recv_buffer );
     gather_completed_checker_.logical_and( tid, deliver_completed );
 
-// Exit gather loop if all local threads and remote processes are
-// done.
-#pragma omp barrier
-    // Resize mpi buffers, if necessary and allowed.
-    if ( not gather_completed_checker_.all_true()
-      and kernel().mpi_manager.adaptive_spike_buffers() )
-    {
+    // Exit gather loop if all local threads and remote processes are
+    // done. all_true() synchronizes all threads, so it must not be
+    // called from within the single region below.
+    const bool gather_completed = gather_completed_checker_.all_true();
+
+// Grow or shrink mpi buffers, if necessary and allowed. The new size
+// takes effect at the beginning of the next round.
 #pragma omp single
-      {
-        buffer_size_spike_data_has_changed_ =
-          kernel().mpi_manager.increase_buffer_size_spike_data();
-      }
-    }
-#pragma omp barrier
+    {
+      buffer_size_spike_data_has_changed_ =
+        kernel().mpi_manager.adapt_buffer_size_spike_data(
+          *std::max_element( max_num_spike_data_per_rank_.begin(),
+            max_num_spike_data_per_rank_.end() ),
+          gather_completed );
+    } // of omp single; implicit barrier
 
   } // of while
 
@@ -450,7 +686,8 @@ EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
   SendBufferPosition& send_buffer_position,
   std::vector< std::vector< std::vector< std::vector< TargetT > > > >&
     spike_register,
-  std::vector< SpikeDataT >& send_buffer )
+  std::vector< SpikeDataT >& send_buffer,
+  const delay max_lag )
 {
   reset_complete_marker_spike_data_(
     assigned_ranks, send_buffer_position, send_buffer );
@@ -459,6 +696,8 @@ EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
   // not be fit into the MPI buffer.
   bool is_spike_register_empty = true;
 
+  const bool count_rejected = kernel().mpi_manager.adaptive_spike_buffers();
+
   // First dimension: loop over writing thread
   for ( typename std::vector< std::
             vector< std::vector< std::vector< TargetT > > > >::iterator it =
@@ -469,7 +708,9 @@ EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
     // Second dimension: fixed reading thread
 
     // Third dimension: loop over lags
-    for ( unsigned int lag = 0; lag < ( *it )[ tid ].size(); ++lag )
+    const size_t num_lags =
+      std::min( ( *it )[ tid ].size(), static_cast< size_t >( max_lag ) );
+    for ( unsigned int lag = 0; lag < num_lags; ++lag )
     {
       // Fourth dimension: loop over entries
       for ( typename std::vector< TargetT >::iterator iiit =
@@ -484,7 +725,11 @@ EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
         if ( send_buffer_position.is_chunk_filled( rank ) )
         {
           is_spike_register_empty = false;
-          if ( send_buffer_position.are_all_chunks_filled() )
+          send_buffer_position.reject( rank );
+          // Adaptive buffers need the number of all spikes that did not
+          // fit, so we can only stop early for fixed buffers.
+          if ( not count_rejected
+            and send_buffer_position.are_all_chunks_filled() )
           {
             return is_spike_register_empty;
           }
@@ -576,6 +821,154 @@ EventDeliveryManager::set_complete_marker_spike_data_(
   }
 }
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::compress_spike_data_buffer_( const thread tid,
+  const AssignedRanks& assigned_ranks,
+  const std::vector< SpikeDataT >& send_buffer )
+{
+  const unsigned int send_recv_count_spike_data_per_rank =
+    kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  const size_t chunk_size = get_compressed_chunk_size_spike_data_();
+  std::vector< std::pair< unsigned int, unsigned int > >& spikes =
+    spike_data_runs_[ tid ];
+
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    const size_t begin = rank * send_recv_count_spike_data_per_rank;
+    const size_t end = begin + send_recv_count_spike_data_per_rank;
+
+    // Collect valid spikes for this rank, see deliver_events_ for the
+    // meaning of markers.
+    spikes.clear();
+    if ( not send_buffer[ begin ].is_invalid_marker() )
+    {
+      for ( size_t i = begin; i < end; ++i )
+      {
+        spikes.push_back( std::make_pair(
+          send_buffer[ i ].get_run_key(), send_buffer[ i ].get_lcid() ) );
+        if ( send_buffer[ i ].is_end_marker() )
+        {
+          break;
+        }
+      }
+    }
+    std::sort( spikes.begin(), spikes.end() );
+
+    unsigned int* const chunk =
+      &send_buffer_compressed_spike_data_[ rank * chunk_size ];
+    size_t pos = 1;
+    unsigned int num_runs = 0;
+    std::vector< std::pair< unsigned int, unsigned int > >::const_iterator it =
+      spikes.begin();
+    while ( it != spikes.end() )
+    {
+      const unsigned int key = it->first;
+      const size_t length_pos = pos + 1;
+      chunk[ pos ] = key;
+      pos += 2;
+      for ( ; it != spikes.end() and it->first == key; ++it )
+      {
+        chunk[ pos ] = it->second;
+        ++pos;
+      }
+      chunk[ length_pos ] = pos - length_pos - 1;
+      ++num_runs;
+    }
+    assert( pos <= chunk_size );
+
+    chunk[ 0 ] =
+      ( num_runs << 1 ) | send_buffer[ end - 1 ].is_complete_marker();
+    send_counts_compressed_spike_data_[ rank ] = pos;
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::decompress_spike_data_buffer_(
+  const AssignedRanks& assigned_ranks,
+  std::vector< SpikeDataT >& recv_buffer ) const
+{
+  const unsigned int send_recv_count_spike_data_per_rank =
+    kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  const size_t chunk_size = get_compressed_chunk_size_spike_data_();
+
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    const size_t begin = rank * send_recv_count_spike_data_per_rank;
+    const size_t end = begin + send_recv_count_spike_data_per_rank;
+    const unsigned int* const chunk =
+      &recv_buffer_compressed_spike_data_[ rank * chunk_size ];
+
+    size_t idx = begin;
+    size_t pos = 1;
+    const unsigned int num_runs = chunk[ 0 ] >> 1;
+    for ( unsigned int run = 0; run < num_runs; ++run )
+    {
+      const unsigned int key = chunk[ pos ];
+      const unsigned int length = chunk[ pos + 1 ];
+      pos += 2;
+      for ( unsigned int i = 0; i < length; ++i, ++pos, ++idx )
+      {
+        recv_buffer[ idx ].set_from_run_key( key, chunk[ pos ] );
+      }
+    }
+    assert( idx <= end );
+    assert( pos
+      == static_cast< size_t >( recv_counts_compressed_spike_data_[ rank ] ) );
+
+    // restore markers as set by the sending rank
+    if ( idx == begin )
+    {
+      recv_buffer[ begin ].set_invalid_marker();
+    }
+    else
+    {
+      recv_buffer[ idx - 1 ].set_end_marker();
+    }
+    if ( chunk[ 0 ] & 1 )
+    {
+      recv_buffer[ end - 1 ].set_complete_marker();
+    }
+    else if ( idx < end )
+    {
+      recv_buffer[ end - 1 ].reset_marker();
+    }
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::set_markers_of_silent_ranks_(
+  std::vector< SpikeDataT >& recv_buffer,
+  const bool complete ) const
+{
+  const unsigned int send_recv_count_spike_data_per_rank =
+    kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+
+  for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes();
+        ++rank )
+  {
+    if ( is_spike_recv_partner_[ rank ] )
+    {
+      continue;
+    }
+
+    recv_buffer[ rank * send_recv_count_spike_data_per_rank ]
+      .set_invalid_marker();
+    SpikeDataT& last =
+      recv_buffer[ ( rank + 1 ) * send_recv_count_spike_data_per_rank - 1 ];
+    if ( complete )
+    {
+      last.set_complete_marker();
+    }
+    else
+    {
+      last.reset_marker();
+    }
+  }
+}
+
 template < typename SpikeDataT >
 bool
 EventDeliveryManager::deliver_events_( const thread tid,
@@ -592,6 +985,24 @@ EventDeliveryManager::deliver_events_( const thread tid,
   assert( kernel().simulation_manager.get_to_step()
     == kernel().connection_manager.get_min_delay() );
 
+  // check last entry of each chunk for completed marker
+  for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes();
+        ++rank )
+  {
+    if ( not recv_buffer[ ( rank + 1 ) * send_recv_count_spike_data_per_rank
+               - 1 ].is_complete_marker() )
+    {
+      are_others_completed = false;
+      break;
+    }
+  }
+
+  // Split received spikes by thread and synapse type, such that each
+  // thread only needs to visit the spikes it has to deliver.
+  sort_spike_data_by_thread_( tid, recv_buffer );
+#pragma omp barrier
+  sort_spike_data_by_syn_id_( tid, recv_buffer );
+
   SpikeEvent se;
 
   // prepare Time objects for every possible time stamp within min_delay_
@@ -605,42 +1016,76 @@ EventDeliveryManager::deliver_events_( const thread tid,
       kernel().simulation_manager.get_clock() + Time::step( lag + 1 );
   }
 
-  for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes();
-        ++rank )
+  // Spikes are grouped by synapse type, such that all spikes of one
+  // synapse type are delivered with a single call to the connector.
+  SpikeBatch& batch = spike_batches_[ tid ];
+  const std::vector< size_t >& positions =
+    sorted_spike_buffer_positions_[ tid ];
+  std::vector< size_t >::const_iterator it = positions.begin();
+  while ( it != positions.end() )
   {
-    // check last entry for completed marker; needs to be done before
-    // checking invalid marker to assure that this is always read
-    if ( not recv_buffer[ ( rank + 1 ) * send_recv_count_spike_data_per_rank
-               - 1 ].is_complete_marker() )
+    const synindex syn_id = recv_buffer[ *it ].get_syn_id();
+
+    batch.clear();
+    for ( ;
+          it != positions.end() and recv_buffer[ *it ].get_syn_id() == syn_id;
+          ++it )
     {
-      are_others_completed = false;
+      const SpikeDataT& spike_data = recv_buffer[ *it ];
+      assert( spike_data.get_tid() == tid );
+
+      const index lcid = spike_data.get_lcid();
+      batch.push_back( lcid,
+        spike_data.get_lag(),
+        spike_data.get_offset(),
+        kernel().connection_manager.get_source_gid( tid, syn_id, lcid ) );
     }
 
+    kernel().connection_manager.send_batch(
+      tid, syn_id, cm, batch, prepared_timestamps, se );
+  }
+
+  return are_others_completed;
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::sort_spike_data_by_thread_( const thread tid,
+  const std::vector< SpikeDataT >& recv_buffer )
+{
+  const unsigned int send_recv_count_spike_data_per_rank =
+    kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+
+  std::vector< std::vector< size_t > >& spike_buffer_positions =
+    spike_buffer_positions_[ tid ];
+  for ( std::vector< std::vector< size_t > >::iterator it =
+          spike_buffer_positions.begin();
+        it != spike_buffer_positions.end();
+        ++it )
+  {
+    it->clear();
+  }
+
+  // Every thread reads the part of the receive buffer that
+  // corresponds to the ranks it also collocates spikes for.
+  const AssignedRanks assigned_ranks =
+    kernel().vp_manager.get_assigned_ranks( tid );
+
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    const size_t begin = rank * send_recv_count_spike_data_per_rank;
+    const size_t end = begin + send_recv_count_spike_data_per_rank;
+
     // continue with next rank if no spikes were sent by this rank
-    if ( recv_buffer[ rank * send_recv_count_spike_data_per_rank ]
-           .is_invalid_marker() )
+    if ( recv_buffer[ begin ].is_invalid_marker() )
     {
       continue;
     }
 
-    for ( unsigned int i = 0; i < send_recv_count_spike_data_per_rank; ++i )
+    for ( size_t i = begin; i < end; ++i )
     {
-      const SpikeDataT& spike_data =
-        recv_buffer[ rank * send_recv_count_spike_data_per_rank + i ];
-
-      if ( spike_data.get_tid() == tid )
-      {
-        se.set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
-        se.set_offset( spike_data.get_offset() );
-
-        const index syn_id = spike_data.get_syn_id();
-        const index lcid = spike_data.get_lcid();
-        const index source_gid =
-          kernel().connection_manager.get_source_gid( tid, syn_id, lcid );
-        se.set_sender_gid( source_gid );
-
-        kernel().connection_manager.send( tid, syn_id, lcid, cm, se );
-      }
+      const SpikeDataT& spike_data = recv_buffer[ i ];
+      spike_buffer_positions[ spike_data.get_tid() ].push_back( i );
 
       // break if this was the last valid entry from this rank
       if ( spike_data.is_end_marker() )
@@ -649,8 +1094,56 @@ EventDeliveryManager::deliver_events_( const thread tid,
       }
     }
   }
+}
 
-  return are_others_completed;
+template < typename SpikeDataT >
+void
+EventDeliveryManager::sort_spike_data_by_syn_id_( const thread tid,
+  const std::vector< SpikeDataT >& recv_buffer )
+{
+  std::vector< size_t >& sorted_positions =
+    sorted_spike_buffer_positions_[ tid ];
+  std::vector< size_t >& syn_id_offsets = syn_id_offsets_[ tid ];
+
+  // Counting sort by synapse type; stable, such that spikes of the
+  // same synapse type are delivered in the order they were received.
+  syn_id_offsets.assign(
+    kernel().model_manager.get_num_synapse_prototypes() + 1, 0 );
+
+  size_t num_spikes = 0;
+  for ( std::vector< std::vector< std::vector< size_t > > >::const_iterator
+          it = spike_buffer_positions_.begin();
+        it != spike_buffer_positions_.end();
+        ++it )
+  {
+    const std::vector< size_t >& positions = ( *it )[ tid ];
+    for ( std::vector< size_t >::const_iterator iit = positions.begin();
+          iit != positions.end();
+          ++iit )
+    {
+      ++syn_id_offsets[ recv_buffer[ *iit ].get_syn_id() + 1 ];
+    }
+    num_spikes += positions.size();
+  }
+
+  std::partial_sum(
+    syn_id_offsets.begin(), syn_id_offsets.end(), syn_id_offsets.begin() );
+
+  sorted_positions.resize( num_spikes );
+  for ( std::vector< std::vector< std::vector< size_t > > >::const_iterator
+          it = spike_buffer_positions_.begin();
+        it != spike_buffer_positions_.end();
+        ++it )
+  {
+    const std::vector< size_t >& positions = ( *it )[ tid ];
+    for ( std::vector< size_t >::const_iterator iit = positions.begin();
+          iit != positions.end();
+          ++iit )
+    {
+      sorted_positions[ syn_id_offsets[ recv_buffer[ *iit ].get_syn_id() ]++ ] =
+        *iit;
+    }
+  }
 }
 
 void
@@ -668,6 +1161,19 @@ EventDeliveryManager::gather_target_data( const thread tid )
   kernel().connection_manager.prepare_target_table( tid );
   kernel().connection_manager.reset_source_table_entry_point( tid );
 
+#pragma omp single
+  {
+    // during incremental updates, only new target data are communicated,
+    // so exchange partners of existing connections have to be kept
+    if ( not kernel().connection_manager.is_incremental_update() )
+    {
+      is_spike_send_partner_.assign(
+        kernel().mpi_manager.get_num_processes(), false );
+      is_spike_recv_partner_.assign(
+        kernel().mpi_manager.get_num_processes(), false );
+    }
+  } // of omp single; implicit barrier
+
   while ( not gather_completed_checker_.all_true() )
   {
     // assume this is the last gather round and change to false
@@ -703,8 +1209,14 @@ EventDeliveryManager::gather_target_data( const thread tid )
     kernel().connection_manager.clean_source_table( tid );
 #pragma omp single
     {
+      // Connections are sent to the rank hosting their source, which
+      // will send spikes to this rank, and vice versa.
+      mark_spike_exchange_partners_(
+        send_buffer_target_data_, is_spike_recv_partner_ );
       kernel().mpi_manager.communicate_target_data_Alltoall(
         send_buffer_target_data_, recv_buffer_target_data_ );
+      mark_spike_exchange_partners_(
+        recv_buffer_target_data_, is_spike_send_partner_ );
     } // of omp single
 
     const bool distribute_completed = distribute_target_data_buffers_( tid );
@@ -724,6 +1236,12 @@ EventDeliveryManager::gather_target_data( const thread tid )
 #pragma omp barrier
   } // of while
 
+#pragma omp single
+  {
+    kernel().mpi_manager.set_spike_exchange_partners(
+      is_spike_send_partner_, is_spike_recv_partner_ );
+  } // of omp single; implicit barrier
+
   kernel().connection_manager.clear_source_table( tid );
 }
 
@@ -880,6 +1398,25 @@ nest::EventDeliveryManager::distribute_target_data_buffers_( const thread tid )
   return are_others_completed;
 }
 
+void
+EventDeliveryManager::mark_spike_exchange_partners_(
+  const std::vector< TargetData >& buffer,
+  std::vector< bool >& is_partner ) const
+{
+  const unsigned int send_recv_count_target_data_per_rank =
+    kernel().mpi_manager.get_send_recv_count_target_data_per_rank();
+
+  for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes();
+        ++rank )
+  {
+    if ( not buffer[ rank * send_recv_count_target_data_per_rank ]
+               .is_invalid_marker() )
+    {
+      is_partner[ rank ] = true;
+    }
+  }
+}
+
 void
 EventDeliveryManager::resize_spike_register_( const thread tid )
 {
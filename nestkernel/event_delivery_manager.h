@@ -26,6 +26,7 @@
 // C++ includes:
 #include <cassert>
 #include <limits>
+#include <utility>
 #include <vector>
 
 // Includes from libnestutil:
@@ -39,8 +40,9 @@
 #include "nest_time.h"
 #include "nest_types.h"
 #include "node.h"
-#include "target_table.h"
+#include "spike_batch.h"
 #include "spike_data.h"
+#include "target_table.h"
 #include "vp_manager.h"
 
 // Includes from sli:
@@ -198,12 +200,34 @@ public:
 
   void configure_secondary_buffers();
 
+  /**
+   * return whether spike communication overlaps with the update of
+   * nodes.
+   */
+  bool get_overlap_spike_communication() const;
+
+  /**
+   * Returns whether spikes are sent in the compressed MPI buffer format.
+   */
+  bool get_compress_spike_data() const;
+
   /**
    * Collocates spikes from register to MPI buffers, communicates via
-   * MPI and delivers events to targets.
+   * MPI and delivers events to targets. Completes a non-blocking
+   * exchange started by start_gather_spike_data() first.
    */
   void gather_spike_data( const thread tid );
 
+  /**
+   * Collocates spikes with lags smaller than max_lag from register to
+   * MPI buffers and starts non-blocking communication, such that it
+   * overlaps with the update of the remaining lags of the current
+   * slice. Spikes that do not fit into the MPI buffers remain in the
+   * register. The received spikes are delivered by the next call to
+   * gather_spike_data().
+   */
+  void start_gather_spike_data( const thread tid, const delay max_lag );
+
   /**
    * Collocates presynaptic connection information, communicates via
    * MPI and creates presynaptic connection infrastructure.
@@ -248,11 +272,25 @@ private:
     std::vector< SpikeDataT >& send_buffer,
     std::vector< SpikeDataT >& recv_buffer );
 
+  template < typename SpikeDataT >
+  void start_gather_spike_data_( const thread tid,
+    const delay max_lag,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Waits for the pending non-blocking exchange of spikes and delivers
+   * the received spikes to their targets.
+   */
+  template < typename SpikeDataT >
+  void complete_gather_spike_data_( const thread tid,
+    std::vector< SpikeDataT >& recv_buffer );
+
   void resize_send_recv_buffers_spike_data_();
 
   /**
-   * Moves spikes from on grid and off grid spike registers to correct
-   * locations in MPI buffers.
+   * Moves spikes with lags smaller than max_lag from on grid and off
+   * grid spike registers to correct locations in MPI buffers.
    */
   template < typename TargetT, typename SpikeDataT >
   bool collocate_spike_data_buffers_( const thread tid,
@@ -260,7 +298,8 @@ private:
     SendBufferPosition& send_buffer_position,
     std::vector< std::vector< std::vector< std::vector< TargetT > > > >&
       spike_register,
-    std::vector< SpikeDataT >& send_buffer );
+    std::vector< SpikeDataT >& send_buffer,
+    const delay max_lag );
 
   /**
    * Marks end of valid regions in MPI buffers.
@@ -288,6 +327,41 @@ private:
     const SendBufferPosition& send_buffer_position,
     std::vector< SpikeDataT >& send_buffer ) const;
 
+  /**
+   * Encodes the spikes for the ranks assigned to this thread in the
+   * compressed MPI buffer format. For each rank, a header entry holds
+   * the number of runs and the completion flag. It is followed by the
+   * runs of spikes with identical thread, synapse type and lag, each
+   * given by a key, its length and the local connection IDs.
+   */
+  template < typename SpikeDataT >
+  void compress_spike_data_buffer_( const thread tid,
+    const AssignedRanks& assigned_ranks,
+    const std::vector< SpikeDataT >& send_buffer );
+
+  /**
+   * Decodes the compressed spikes from the ranks assigned to this
+   * thread into the MPI receive buffer, including all markers.
+   */
+  template < typename SpikeDataT >
+  void decompress_spike_data_buffer_( const AssignedRanks& assigned_ranks,
+    std::vector< SpikeDataT >& recv_buffer ) const;
+
+  /**
+   * Returns the number of entries per rank in the compressed MPI
+   * buffers, which suffices for the worst case of one run per spike.
+   */
+  size_t get_compressed_chunk_size_spike_data_() const;
+
+  /**
+   * Marks the parts of the MPI receive buffer that belong to ranks
+   * which do not send spikes to this rank during a sparse exchange as
+   * empty. These ranks signal completion only if complete is true.
+   */
+  template < typename SpikeDataT >
+  void set_markers_of_silent_ranks_( std::vector< SpikeDataT >& recv_buffer,
+    const bool complete ) const;
+
   /**
    * Reads spikes from MPI buffers and delivers them to ringbuffer of
    * nodes.
@@ -296,6 +370,24 @@ private:
   bool deliver_events_( const thread tid,
     const std::vector< SpikeDataT >& recv_buffer );
 
+  /**
+   * Sorts positions of valid entries in the part of the MPI receive
+   * buffer assigned to thread tid according to the thread that needs
+   * to deliver the corresponding spikes.
+   */
+  template < typename SpikeDataT >
+  void sort_spike_data_by_thread_( const thread tid,
+    const std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Collects positions of all spikes that need to be delivered by
+   * thread tid and groups them by synapse type. Must only be called
+   * after all threads have finished sort_spike_data_by_thread_.
+   */
+  template < typename SpikeDataT >
+  void sort_spike_data_by_syn_id_( const thread tid,
+    const std::vector< SpikeDataT >& recv_buffer );
+
   /**
    * Deletes all spikes from spike registers and resets spike
    * counters.
@@ -346,6 +438,14 @@ private:
    */
   bool distribute_target_data_buffers_( const thread tid );
 
+  /**
+   * Marks all ranks whose part of the MPI buffer for connections
+   * contains valid entries as partners for the exchange of spikes.
+   */
+  void mark_spike_exchange_partners_(
+    const std::vector< TargetData >& buffer,
+    std::vector< bool >& is_partner ) const;
+
   /**
    * Sends event e to all targets of node source. Delivers events from
    * devices directly to targets.
@@ -358,6 +458,16 @@ private:
   bool off_grid_spiking_; //!< indicates whether spikes are not constrained to
                           //!< the grid
 
+  bool overlap_spike_communication_; //!< indicates whether spikes of the
+  //!< first part of a slice are communicated while the nodes are updated
+  //!< for the remaining part of the slice
+
+  bool compress_spike_data_; //!< indicates whether on-grid spikes are sent
+  //!< in the compressed MPI buffer format
+
+  bool spike_data_exchange_pending_; //!< whether a non-blocking exchange of
+                                     //!< spikes has been started
+
   /**
    * Table of pre-computed modulos.
    * This table is used to map time steps, given as offset from now,
@@ -431,8 +541,63 @@ private:
    */
   std::vector< unsigned long > local_spike_counter_;
 
+  /**
+   * Positions of received spikes in the MPI receive buffer, sorted by
+   * thread that needs to deliver them. This is a 3-dim structure.
+   * - First dim: reading threads (from MPI buffer)
+   * - Second dim: delivering threads (from MPI buffer to targets)
+   * - Third dim: position in MPI receive buffer
+   */
+  std::vector< std::vector< std::vector< size_t > > > spike_buffer_positions_;
+
+  /**
+   * Positions of all received spikes that need to be delivered by a
+   * thread, grouped by synapse type.
+   * - First dim: delivering threads
+   * - Second dim: position in MPI receive buffer
+   */
+  std::vector< std::vector< size_t > > sorted_spike_buffer_positions_;
+
+  /**
+   * Number of received spikes per synapse type for each delivering
+   * thread, used as offsets while grouping spikes by synapse type.
+   */
+  std::vector< std::vector< size_t > > syn_id_offsets_;
+
+  /**
+   * Spikes of a single synapse type that are delivered with one call to
+   * ConnectionManager::send_batch(), for each delivering thread.
+   */
+  std::vector< SpikeBatch > spike_batches_;
+
+  /**
+   * Largest number of spikes each thread needed to send to any of its
+   * assigned ranks in the current communication round, including spikes
+   * that did not fit into the MPI buffer. Used to adapt the buffer size.
+   */
+  std::vector< size_t > max_num_spike_data_per_rank_;
+
+  //! ranks that host targets of local neurons, learned from the
+  //! communication of connections
+  std::vector< bool > is_spike_send_partner_;
+
+  //! ranks that host sources of local neurons, learned from the
+  //! communication of connections
+  std::vector< bool > is_spike_recv_partner_;
+
   std::vector< SpikeData > send_buffer_spike_data_;
   std::vector< SpikeData > recv_buffer_spike_data_;
+
+  //! MPI buffers in compressed format and number of used entries per rank
+  std::vector< unsigned int > send_buffer_compressed_spike_data_;
+  std::vector< unsigned int > recv_buffer_compressed_spike_data_;
+  std::vector< int > send_counts_compressed_spike_data_;
+  std::vector< int > recv_counts_compressed_spike_data_;
+
+  //! Pairs of run key and local connection ID of the spikes for one
+  //! rank, used by each thread to sort spikes during compression
+  std::vector< std::vector< std::pair< unsigned int, unsigned int > > >
+    spike_data_runs_;
   std::vector< OffGridSpikeData > send_buffer_off_grid_spike_data_;
   std::vector< OffGridSpikeData > recv_buffer_off_grid_spike_data_;
 
@@ -531,6 +696,18 @@ EventDeliveryManager::get_off_grid_communication() const
   return off_grid_spiking_;
 }
 
+inline bool
+EventDeliveryManager::get_overlap_spike_communication() const
+{
+  return overlap_spike_communication_;
+}
+
+inline bool
+EventDeliveryManager::get_compress_spike_data() const
+{
+  return compress_spike_data_;
+}
+
 inline void
 EventDeliveryManager::set_off_grid_communication( bool off_grid_spiking )
 {
@@ -35,6 +35,7 @@
 #include "logging.h"
 
 // Includes from nestkernel:
+#include "exceptions.h"
 #include "kernel_manager.h"
 
 // Includes from sli:
@@ -42,6 +43,8 @@
 
 nest::IOManager::IOManager()
   : overwrite_files_( false )
+  , asynchronous_output_( false )
+  , output_writer_()
 {
 }
 
@@ -120,6 +123,12 @@ nest::IOManager::finalize()
   data_path_ = "";
   data_prefix_ = "";
   overwrite_files_ = false;
+
+  // all devices have been destroyed, thus all output has been written
+  output_writer_.stop();
+  output_writer_.reset_counters();
+  output_writer_.set_max_queued_bytes( 64 << 20 );
+  asynchronous_output_ = false;
 }
 
 /*
@@ -130,6 +139,17 @@ nest::IOManager::set_status( const DictionaryDatum& d )
 {
   set_data_path_prefix_( d );
   updateValue< bool >( d, names::overwrite_files, overwrite_files_ );
+  updateValue< bool >( d, names::asynchronous_output, asynchronous_output_ );
+
+  long output_queue_size;
+  if ( updateValue< long >( d, names::output_queue_size, output_queue_size ) )
+  {
+    if ( output_queue_size <= 0 )
+    {
+      throw BadProperty( "output_queue_size must be positive." );
+    }
+    output_writer_.set_max_queued_bytes( output_queue_size );
+  }
 }
 
 void
@@ -138,4 +158,12 @@ nest::IOManager::get_status( DictionaryDatum& d )
   ( *d )[ names::data_path ] = data_path_;
   ( *d )[ names::data_prefix ] = data_prefix_;
   ( *d )[ names::overwrite_files ] = overwrite_files_;
+
+  ( *d )[ names::asynchronous_output ] = asynchronous_output_;
+  ( *d )[ names::output_queue_size ] =
+    static_cast< long >( output_writer_.get_max_queued_bytes() );
+  ( *d )[ names::output_wait_time ] = output_writer_.get_wait_time();
+  ( *d )[ names::output_write_time ] = output_writer_.get_write_time();
+  ( *d )[ names::output_bytes_written ] =
+    static_cast< long >( output_writer_.get_bytes_written() );
 }
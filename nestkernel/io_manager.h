@@ -29,6 +29,9 @@
 // Includes from libnestutil:
 #include "manager_interface.h"
 
+// Includes from nestkernel:
+#include "async_output_writer.h"
+
 // Includes from sli:
 #include "dictdatum.h"
 
@@ -75,10 +78,25 @@ public:
    */
   bool overwrite_files() const;
 
+  /**
+   * Indicate if recording devices should write files asynchronously.
+   * @see get_output_writer()
+   */
+  bool asynchronous_output() const;
+
+  /**
+   * The writer thread for asynchronous file output of recording devices.
+   */
+  AsyncOutputWriter& get_output_writer();
+
 private:
   std::string data_path_;   //!< Path for all files written by devices
   std::string data_prefix_; //!< Prefix for all files written by devices
   bool overwrite_files_;    //!< If true, overwrite existing data files.
+
+  //! If true, devices hand their file output to output_writer_
+  bool asynchronous_output_;
+  AsyncOutputWriter output_writer_;
 };
 }
 
@@ -101,4 +119,16 @@ nest::IOManager::overwrite_files() const
   return overwrite_files_;
 }
 
+inline bool
+nest::IOManager::asynchronous_output() const
+{
+  return asynchronous_output_;
+}
+
+inline nest::AsyncOutputWriter&
+nest::IOManager::get_output_writer()
+{
+  return output_writer_;
+}
+
 #endif /* IO_MANAGER_H */
@@ -69,6 +69,41 @@
  num_processes                 integertype - The number of MPI processes (read only)
  off_grid_spiking              booltype    - Whether to transmit precise spike times in MPI
                                              communication (read only)
+ overlap_spike_communication   booltype    - Whether to communicate spikes of the first half
+                                             of each time slice while the second half is
+                                             updated (requires MPI-3 to be effective)
+ compress_spike_data           booltype    - Whether to send on-grid spikes in a compressed format
+                                             with 32 bits per spike, grouped by thread, synapse
+                                             type and lag
+ num_bytes_spike_data_sent     integertype - Number of bytes sent by this process during the
+                                             communication of spikes (read only)
+ sparse_spike_exchange         booltype    - Whether to exchange spikes only between ranks that
+                                             host connected neurons instead of using a dense
+                                             Alltoall
+ spike_send_partners           arraytype   - Ranks hosting targets of neurons of this process,
+                                             to which spikes are sent if sparse_spike_exchange
+                                             is set (read only)
+ spike_recv_partners           arraytype   - Ranks hosting sources of neurons of this process,
+                                             from which spikes are received if
+                                             sparse_spike_exchange is set (read only)
+ spike_buffer_grow_extra       doubletype  - Relative headroom added when the MPI buffer for
+                                             spikes grows to fit the observed demand
+ spike_buffer_shrink_limit     doubletype  - The MPI buffer for spikes shrinks if this fraction
+                                             of it sufficed during the last spike_buffer_shrink_delay
+                                             time slices
+ spike_buffer_shrink_delay     integertype - Number of time slices between checks for shrinking
+                                             the MPI buffer for spikes
+ num_spike_buffer_resizes      integertype - Number of size changes of the MPI buffer for spikes
+                                             (read only)
+ num_spike_data_gathers        integertype - Number of completed spike exchanges (read only)
+ num_spike_data_rounds         integertype - Number of communication rounds needed for spike
+                                             exchanges (read only)
+ thread_numa_nodes             arraytype   - NUMA node of the CPU each thread runs on, -1 if
+                                             unknown (read only)
+ node_numa_nodes               arraytype   - NUMA node holding the memory of the first neuron
+                                             of each thread, -1 if unknown (read only)
+ connection_numa_nodes         arraytype   - NUMA node holding the memory of the first connector
+                                             of each thread, -1 if unknown (read only)
 
  Connector configuration
  initial_connector_capacity    integertype - When a connector is first created, it starts with this
@@ -92,6 +127,18 @@
                                              (default is the current directory)
  data_prefix                   stringtype  - A common prefix for all data files
  overwrite_files               booltype    - Whether to overwrite existing data files
+ asynchronous_output           booltype    - Whether recording devices hand their file output
+                                             to a background thread, which writes it while
+                                             the simulation continues (default: false)
+ output_queue_size             integertype - Maximal number of bytes queued for asynchronous
+                                             output; devices wait when the queue is full
+                                             (default: 64 MB)
+ output_wait_time              doubletype  - Time in seconds threads spent waiting for
+                                             asynchronous output (read only)
+ output_write_time             doubletype  - Time in seconds spent writing asynchronous
+                                             output (read only)
+ output_bytes_written          integertype - Number of bytes of asynchronous output written
+                                             (read only)
  print_time                    booltype    - Whether to print progress information during the simulation
 
  Network information
@@ -108,6 +155,9 @@
 
  Miscellaneous
  dict_miss_is_error            booltype    - Whether missed dictionary entries are treated as errors
+ batch_update                  booltype    - Whether to update consecutive neurons of the same model on
+                                             a thread in a single batch (supported by aeif_cond_alpha,
+                                             iaf_psc_alpha, iaf_psc_delta and iaf_psc_exp)
 
  SeeAlso: Simulate, Node
  */
@@ -23,6 +23,8 @@
 #include "mpi_manager.h"
 
 // C++ includes:
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <numeric>
 
@@ -38,6 +40,7 @@
 #include "nodelist.h"
 
 // Includes from sli:
+#include "arraydatum.h"
 #include "dictutils.h"
 
 #ifdef HAVE_MPI
@@ -66,8 +69,19 @@ nest::MPIManager::MPIManager()
   , max_buffer_size_spike_data_( 8388608 )
   , adaptive_target_buffers_( true )
   , adaptive_spike_buffers_( true )
+  , sparse_spike_exchange_( false )
+  , spike_send_partners_()
+  , spike_recv_partners_()
   , growth_factor_buffer_spike_data_( 1.5 )
   , growth_factor_buffer_target_data_( 1.5 )
+  , spike_buffer_grow_extra_( 0.5 )
+  , spike_buffer_shrink_limit_( 0.2 )
+  , spike_buffer_shrink_delay_( 100 )
+  , max_num_spike_data_per_rank_( 0 )
+  , num_spike_buffer_resizes_( 0 )
+  , num_spike_data_gathers_( 0 )
+  , num_spike_data_rounds_( 0 )
+  , num_bytes_spike_data_sent_( 0 )
   , send_recv_count_spike_data_per_rank_( 0 )
   , send_recv_count_target_data_per_rank_( 0 )
 #ifdef HAVE_MPI
@@ -75,6 +89,7 @@ nest::MPIManager::MPIManager()
   , COMM_OVERFLOW_ERROR( std::numeric_limits< unsigned int >::max() )
   , comm( 0 )
   , MPI_OFFGRID_SPIKE( 0 )
+  , ialltoall_request_( MPI_REQUEST_NULL )
 #endif
 {
 }
@@ -156,11 +171,19 @@ nest::MPIManager::init_mpi( int* argc, char** argv[] )
 void
 nest::MPIManager::initialize()
 {
+  max_num_spike_data_per_rank_ = 0;
+  num_spike_buffer_resizes_ = 0;
+  num_spike_data_gathers_ = 0;
+  num_spike_data_rounds_ = 0;
+  num_bytes_spike_data_sent_ = 0;
+  sparse_spike_exchange_ = false;
 }
 
 void
 nest::MPIManager::finalize()
 {
+  spike_send_partners_.clear();
+  spike_recv_partners_.clear();
 }
 
 void
@@ -170,6 +193,8 @@ nest::MPIManager::set_status( const DictionaryDatum& dict )
     dict, names::adaptive_target_buffers, adaptive_target_buffers_ );
   updateValue< bool >(
     dict, names::adaptive_spike_buffers, adaptive_spike_buffers_ );
+  updateValue< bool >(
+    dict, names::sparse_spike_exchange, sparse_spike_exchange_ );
 
   long new_buffer_size_target_data = buffer_size_target_data_;
   updateValue< long >(
@@ -204,6 +229,39 @@ nest::MPIManager::set_status( const DictionaryDatum& dict )
     dict, names::max_buffer_size_target_data, max_buffer_size_target_data_ );
   updateValue< long >(
     dict, names::max_buffer_size_spike_data, max_buffer_size_spike_data_ );
+
+  double grow_extra = spike_buffer_grow_extra_;
+  if ( updateValue< double >(
+         dict, names::spike_buffer_grow_extra, grow_extra ) )
+  {
+    if ( grow_extra < 0.0 )
+    {
+      throw BadProperty( "spike_buffer_grow_extra must not be negative." );
+    }
+    spike_buffer_grow_extra_ = grow_extra;
+  }
+
+  double shrink_limit = spike_buffer_shrink_limit_;
+  if ( updateValue< double >(
+         dict, names::spike_buffer_shrink_limit, shrink_limit ) )
+  {
+    if ( shrink_limit < 0.0 or shrink_limit > 1.0 )
+    {
+      throw BadProperty( "spike_buffer_shrink_limit must be in [0, 1]." );
+    }
+    spike_buffer_shrink_limit_ = shrink_limit;
+  }
+
+  long shrink_delay = spike_buffer_shrink_delay_;
+  if ( updateValue< long >(
+         dict, names::spike_buffer_shrink_delay, shrink_delay ) )
+  {
+    if ( shrink_delay < 1 )
+    {
+      throw BadProperty( "spike_buffer_shrink_delay must be positive." );
+    }
+    spike_buffer_shrink_delay_ = shrink_delay;
+  }
 }
 
 void
@@ -212,6 +270,7 @@ nest::MPIManager::get_status( DictionaryDatum& dict )
   def< long >( dict, names::num_processes, num_processes_ );
   def< bool >( dict, names::adaptive_spike_buffers, adaptive_spike_buffers_ );
   def< bool >( dict, names::adaptive_target_buffers, adaptive_target_buffers_ );
+  def< bool >( dict, names::sparse_spike_exchange, sparse_spike_exchange_ );
   def< size_t >(
     dict, names::buffer_size_target_data, buffer_size_target_data_ );
   def< size_t >( dict, names::buffer_size_spike_data, buffer_size_spike_data_ );
@@ -228,6 +287,122 @@ nest::MPIManager::get_status( DictionaryDatum& dict )
   def< double >( dict,
     names::growth_factor_buffer_target_data,
     growth_factor_buffer_target_data_ );
+  def< double >( dict, names::spike_buffer_grow_extra, spike_buffer_grow_extra_ );
+  def< double >(
+    dict, names::spike_buffer_shrink_limit, spike_buffer_shrink_limit_ );
+  def< long >(
+    dict, names::spike_buffer_shrink_delay, spike_buffer_shrink_delay_ );
+  def< unsigned long >(
+    dict, names::num_spike_buffer_resizes, num_spike_buffer_resizes_ );
+  def< unsigned long >(
+    dict, names::num_spike_data_gathers, num_spike_data_gathers_ );
+  def< unsigned long >(
+    dict, names::num_spike_data_rounds, num_spike_data_rounds_ );
+  def< unsigned long >(
+    dict, names::num_bytes_spike_data_sent, num_bytes_spike_data_sent_ );
+
+  ArrayDatum spike_send_partners_ad( std::vector< long >(
+    spike_send_partners_.begin(), spike_send_partners_.end() ) );
+  def< ArrayDatum >( dict, names::spike_send_partners, spike_send_partners_ad );
+  ArrayDatum spike_recv_partners_ad( std::vector< long >(
+    spike_recv_partners_.begin(), spike_recv_partners_.end() ) );
+  def< ArrayDatum >( dict, names::spike_recv_partners, spike_recv_partners_ad );
+}
+
+void
+nest::MPIManager::set_spike_exchange_partners(
+  const std::vector< bool >& send_to_rank,
+  const std::vector< bool >& recv_from_rank )
+{
+  assert( send_to_rank.size() == static_cast< size_t >( num_processes_ ) );
+  assert( recv_from_rank.size() == static_cast< size_t >( num_processes_ ) );
+
+  spike_send_partners_.clear();
+  spike_recv_partners_.clear();
+  for ( int rank = 0; rank < num_processes_; ++rank )
+  {
+    if ( send_to_rank[ rank ] )
+    {
+      spike_send_partners_.push_back( rank );
+    }
+    if ( recv_from_rank[ rank ] )
+    {
+      spike_recv_partners_.push_back( rank );
+    }
+  }
+}
+
+bool
+nest::MPIManager::adapt_buffer_size_spike_data(
+  const size_t max_num_spike_data_per_rank,
+  const bool completed )
+{
+  ++num_spike_data_rounds_;
+  max_num_spike_data_per_rank_ =
+    std::max( max_num_spike_data_per_rank_, max_num_spike_data_per_rank );
+
+  if ( completed )
+  {
+    ++num_spike_data_gathers_;
+  }
+
+  if ( not adaptive_spike_buffers_ )
+  {
+    return false;
+  }
+
+  const size_t old_buffer_size = buffer_size_spike_data_;
+  const size_t num_processes = get_num_processes();
+
+  if ( not completed )
+  {
+    // All ranks arrive here in the same round, since completion is
+    // determined globally. Grow to the largest demand of any rank.
+    std::vector< long > global_max( 1, max_num_spike_data_per_rank );
+    communicate_Allreduce_max_in_place( global_max );
+
+    const size_t requested_per_rank = static_cast< size_t >(
+      std::ceil( global_max[ 0 ] * ( 1.0 + spike_buffer_grow_extra_ ) ) );
+    const size_t grown_per_rank = static_cast< size_t >( std::floor(
+      send_recv_count_spike_data_per_rank_
+      * growth_factor_buffer_spike_data_ ) );
+    const size_t new_buffer_size =
+      std::max( requested_per_rank, grown_per_rank ) * num_processes;
+
+    // this also adjusts send_recv_count_spike_data_per_rank_ and limits
+    // the size to max_buffer_size_spike_data_
+    set_buffer_size_spike_data(
+      std::min( new_buffer_size, max_buffer_size_spike_data_ ) );
+  }
+  else if ( num_spike_data_gathers_ % spike_buffer_shrink_delay_ == 0 )
+  {
+    // Number of completed gathers is identical on all ranks, so all
+    // ranks check for shrinking in the same slice.
+    std::vector< long > global_max( 1, max_num_spike_data_per_rank_ );
+    communicate_Allreduce_max_in_place( global_max );
+    max_num_spike_data_per_rank_ = 0;
+
+    if ( global_max[ 0 ]
+      < spike_buffer_shrink_limit_ * send_recv_count_spike_data_per_rank_ )
+    {
+      // at least two entries per rank are required for the markers
+      const size_t new_per_rank =
+        std::max( static_cast< size_t >( 2 ),
+          static_cast< size_t >( std::ceil(
+            global_max[ 0 ] * ( 1.0 + spike_buffer_grow_extra_ ) ) ) );
+      if ( new_per_rank < send_recv_count_spike_data_per_rank_ )
+      {
+        set_buffer_size_spike_data( new_per_rank * num_processes );
+      }
+    }
+  }
+
+  if ( buffer_size_spike_data_ != old_buffer_size )
+  {
+    ++num_spike_buffer_resizes_;
+    return true;
+  }
+  return false;
 }
 
 /**
@@ -748,6 +923,113 @@ nest::MPIManager::communicate_secondary_events_Alltoall_( void* send_buffer,
     comm );
 }
 
+void
+nest::MPIManager::communicate_Ialltoall_( void* send_buffer,
+  void* recv_buffer,
+  const unsigned int send_recv_count )
+{
+#if MPI_VERSION >= 3
+  MPI_Ialltoall( send_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    recv_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    comm,
+    &ialltoall_request_ );
+#else
+  // non-blocking collectives require MPI-3
+  communicate_Alltoall_( send_buffer, recv_buffer, send_recv_count );
+#endif
+}
+
+void
+nest::MPIManager::communicate_sparse_( void* send_buffer,
+  void* recv_buffer,
+  const unsigned int send_recv_count )
+{
+  unsigned int* send_buffer_uint = static_cast< unsigned int* >( send_buffer );
+  unsigned int* recv_buffer_uint = static_cast< unsigned int* >( recv_buffer );
+
+  std::vector< MPI_Request > requests(
+    spike_recv_partners_.size() + spike_send_partners_.size() );
+  if ( requests.empty() )
+  {
+    return;
+  }
+
+  // Post all receives first; messages between each pair of ranks are
+  // matched in order, so consecutive rounds can not be confused.
+  size_t i = 0;
+  for ( std::vector< int >::const_iterator it = spike_recv_partners_.begin();
+        it != spike_recv_partners_.end();
+        ++it, ++i )
+  {
+    MPI_Irecv( recv_buffer_uint + *it * send_recv_count,
+      send_recv_count,
+      MPI_UNSIGNED,
+      *it,
+      0,
+      comm,
+      &requests[ i ] );
+  }
+  for ( std::vector< int >::const_iterator it = spike_send_partners_.begin();
+        it != spike_send_partners_.end();
+        ++it, ++i )
+  {
+    MPI_Isend( send_buffer_uint + *it * send_recv_count,
+      send_recv_count,
+      MPI_UNSIGNED,
+      *it,
+      0,
+      comm,
+      &requests[ i ] );
+  }
+
+  MPI_Waitall( requests.size(), &requests[ 0 ], MPI_STATUSES_IGNORE );
+}
+
+void
+nest::MPIManager::communicate_compressed_spike_data_Alltoallv(
+  std::vector< unsigned int >& send_buffer,
+  std::vector< int >& send_counts,
+  std::vector< unsigned int >& recv_buffer,
+  std::vector< int >& recv_counts,
+  const size_t chunk_size )
+{
+  MPI_Alltoall(
+    &send_counts[ 0 ], 1, MPI_INT, &recv_counts[ 0 ], 1, MPI_INT, comm );
+
+  // the parts for all ranks start at the same positions in both buffers
+  std::vector< int > displacements( num_processes_ );
+  for ( int rank = 0; rank < num_processes_; ++rank )
+  {
+    displacements[ rank ] = rank * chunk_size;
+  }
+
+  MPI_Alltoallv( &send_buffer[ 0 ],
+    &send_counts[ 0 ],
+    &displacements[ 0 ],
+    MPI_UNSIGNED,
+    &recv_buffer[ 0 ],
+    &recv_counts[ 0 ],
+    &displacements[ 0 ],
+    MPI_UNSIGNED,
+    comm );
+
+  num_bytes_spike_data_sent_ += sizeof( int ) * num_processes_
+    + sizeof( unsigned int )
+      * std::accumulate( send_counts.begin(), send_counts.end(), 0 );
+}
+
+void
+nest::MPIManager::wait_Ialltoall()
+{
+#if MPI_VERSION >= 3
+  MPI_Wait( &ialltoall_request_, MPI_STATUS_IGNORE );
+#endif
+}
+
 /**
  * Ensure all processes have reached the same stage by waiting until all
  * processes have sent a dummy message to process 0.
@@ -1214,4 +1496,18 @@ nest::MPIManager::communicate_Allreduce_max_in_place(
   // Max already is the input
 }
 
+void
+nest::MPIManager::communicate_compressed_spike_data_Alltoallv(
+  std::vector< unsigned int >& send_buffer,
+  std::vector< int >& send_counts,
+  std::vector< unsigned int >& recv_buffer,
+  std::vector< int >& recv_counts,
+  const size_t )
+{
+  recv_buffer.swap( send_buffer );
+  recv_counts.swap( send_counts );
+  num_bytes_spike_data_sent_ += sizeof( int )
+    + sizeof( unsigned int ) * recv_counts[ 0 ];
+}
+
 #endif /* #ifdef HAVE_MPI */
@@ -210,8 +210,29 @@ public:
 
   void communicate_secondary_events_Alltoall_( void* send_buffer,
     void* recv_buffer );
+
+  void communicate_Ialltoall_( void* send_buffer,
+    void* recv_buffer,
+    const unsigned int send_recv_count );
+
+  void communicate_sparse_( void* send_buffer,
+    void* recv_buffer,
+    const unsigned int send_recv_count );
 #endif // HAVE_MPI
 
+  /**
+   * Communicates spikes in the compressed MPI buffer format. The part
+   * of the buffers for each rank has chunk_size entries, of which only
+   * the number given in send_counts is sent. The number of entries
+   * received from each rank is stored in recv_counts.
+   */
+  void communicate_compressed_spike_data_Alltoallv(
+    std::vector< unsigned int >& send_buffer,
+    std::vector< int >& send_counts,
+    std::vector< unsigned int >& recv_buffer,
+    std::vector< int >& recv_counts,
+    const size_t chunk_size );
+
   template < class D >
   void communicate_Alltoall( std::vector< D >& send_buffer,
     std::vector< D >& recv_buffer,
@@ -229,6 +250,52 @@ public:
   void communicate_secondary_events_Alltoall( std::vector< D >& send_buffer,
     std::vector< D >& recv_buffer );
 
+  /**
+   * Non-blocking variants of the Alltoall communication of spikes. The
+   * buffers must not be accessed before wait_Ialltoall() has returned.
+   * Without MPI-3 support, these fall back to blocking communication.
+   */
+  template < class D >
+  void communicate_Ialltoall( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer,
+    const unsigned int send_recv_count );
+  template < class D >
+  void communicate_spike_data_Ialltoall( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer );
+  template < class D >
+  void communicate_off_grid_spike_data_Ialltoall( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer );
+
+  /**
+   * Blocks until the pending non-blocking Alltoall has completed.
+   */
+  void wait_Ialltoall();
+
+  /**
+   * Exchanges the parts of the buffers that belong to the partners set
+   * by set_spike_exchange_partners() using point-to-point
+   * communication. All other parts of the receive buffer are left
+   * untouched. The buffer layout is identical to communicate_Alltoall.
+   */
+  template < class D >
+  void communicate_sparse( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer,
+    const unsigned int send_recv_count );
+
+  /**
+   * Sets the ranks this rank sends spikes to and receives spikes from,
+   * i.e., the ranks hosting targets of local neurons and the ranks
+   * hosting sources of local neurons, respectively.
+   */
+  void set_spike_exchange_partners( const std::vector< bool >& send_to_rank,
+    const std::vector< bool >& recv_from_rank );
+
+  /**
+   * Returns whether spikes are only exchanged between ranks that are
+   * connected, instead of using a dense Alltoall.
+   */
+  bool sparse_spike_exchange() const;
+
   void synchronize();
 
   // TODO: not used...
@@ -267,10 +334,22 @@ public:
   bool increase_buffer_size_target_data();
 
   /**
-   * Increases the size of the MPI buffer for communication of spikes if it
-   * needs to be increased. Returns whether the size was changed.
+   * Adapts the size of the MPI buffer for communication of spikes after
+   * each communication round. Must be called by all ranks for every
+   * round.
+   *
+   * If the communication of spikes has not completed, the buffer grows
+   * to fit the largest number of spikes any rank needs to send to any
+   * other rank, plus headroom. The buffer only shrinks if it was
+   * oversized for spike_buffer_shrink_delay consecutive time slices.
+   * Returns whether the size was changed.
+   *
+   * @param max_num_spike_data_per_rank maximal number of spikes this rank
+   *        needed to send to any rank in this round
+   * @param completed whether all ranks completed the communication
    */
-  bool increase_buffer_size_spike_data();
+  bool adapt_buffer_size_spike_data( const size_t max_num_spike_data_per_rank,
+    const bool completed );
 
   /**
    * Returns whether MPI buffers for communication of connections are adaptive.
@@ -309,9 +388,42 @@ private:
   bool adaptive_spike_buffers_; //!< whether MPI buffers for communication of
   // spikes resize on the fly
 
+  bool sparse_spike_exchange_; //!< whether spikes are only exchanged between
+  // connected ranks
+
+  std::vector< int > spike_send_partners_; //!< ranks hosting targets of
+  // local neurons
+
+  std::vector< int > spike_recv_partners_; //!< ranks hosting sources of
+  // local neurons
+
   double growth_factor_buffer_spike_data_;
   double growth_factor_buffer_target_data_;
 
+  double spike_buffer_grow_extra_; //!< relative headroom added when growing
+  // MPI buffer for communication of spikes
+
+  double spike_buffer_shrink_limit_; //!< MPI buffer for communication of
+  // spikes is oversized if this fraction of it suffices
+
+  long spike_buffer_shrink_delay_; //!< number of slices MPI buffer for
+  // communication of spikes needs to be oversized before it shrinks
+
+  size_t max_num_spike_data_per_rank_; //!< maximal number of spikes sent
+  // to any rank since last check for shrinking the MPI buffer
+
+  unsigned long num_spike_buffer_resizes_; //!< number of changes of the size
+  // of the MPI buffer for communication of spikes
+
+  unsigned long num_spike_data_gathers_; //!< number of completed
+  // communications of spikes, usually one per slice
+
+  unsigned long num_spike_data_rounds_; //!< number of communication rounds
+  // needed for the communication of spikes
+
+  unsigned long num_bytes_spike_data_sent_; //!< number of bytes sent by this
+  // rank during the communication of spikes
+
   unsigned int send_recv_count_spike_data_per_rank_;
   unsigned int send_recv_count_target_data_per_rank_;
 
@@ -327,6 +439,7 @@ private:
   MPI_Comm comm;
 #endif /* #ifdef HAVE_MUSIC */
   MPI_Datatype MPI_OFFGRID_SPIKE;
+  MPI_Request ialltoall_request_; //!< request of pending non-blocking Alltoall
 
   void communicate_Allgather( std::vector< unsigned int >& send_buffer,
     std::vector< unsigned int >& recv_buffer,
@@ -609,30 +722,6 @@ MPIManager::increase_buffer_size_target_data()
   }
 }
 
-inline bool
-MPIManager::increase_buffer_size_spike_data()
-{
-  assert( adaptive_spike_buffers_ );
-  if ( buffer_size_spike_data_ >= max_buffer_size_spike_data_ )
-  {
-    return false;
-  }
-  else
-  {
-    if ( buffer_size_spike_data_ * growth_factor_buffer_spike_data_
-      < max_buffer_size_spike_data_ )
-    {
-      set_buffer_size_spike_data(
-        floor( buffer_size_spike_data_ * growth_factor_buffer_spike_data_ ) );
-    }
-    else
-    {
-      set_buffer_size_spike_data( max_buffer_size_spike_data_ );
-    }
-    return true;
-  }
-}
-
 inline bool
 MPIManager::adaptive_target_buffers() const
 {
@@ -645,6 +734,12 @@ MPIManager::adaptive_spike_buffers() const
   return adaptive_spike_buffers_;
 }
 
+inline bool
+MPIManager::sparse_spike_exchange() const
+{
+  return sparse_spike_exchange_;
+}
+
 #ifndef HAVE_MPI
 inline std::string
 MPIManager::get_processor_name()
@@ -736,6 +831,11 @@ MPIManager::time_communicate_alltoallv( int, int )
   return 0.0;
 }
 
+inline void
+MPIManager::wait_Ialltoall()
+{
+}
+
 #endif /* HAVE_MPI */
 
 #ifdef HAVE_MPI
@@ -763,6 +863,29 @@ MPIManager::communicate_secondary_events_Alltoall(
   communicate_secondary_events_Alltoall_( send_buffer_int, recv_buffer_int );
 }
 
+template < class D >
+void
+MPIManager::communicate_Ialltoall( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int send_recv_count )
+{
+  void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
+  void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
+
+  communicate_Ialltoall_( send_buffer_int, recv_buffer_int, send_recv_count );
+}
+
+template < class D >
+void
+MPIManager::communicate_sparse( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int send_recv_count )
+{
+  void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
+  void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
+
+  communicate_sparse_( send_buffer_int, recv_buffer_int, send_recv_count );
+}
 
 #else // HAVE_MPI
 template < class D >
@@ -783,6 +906,29 @@ MPIManager::communicate_secondary_events_Alltoall(
   recv_buffer.swap( send_buffer );
 }
 
+template < class D >
+void
+MPIManager::communicate_Ialltoall( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int )
+{
+  recv_buffer.swap( send_buffer );
+}
+
+template < class D >
+void
+MPIManager::communicate_sparse( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int )
+{
+  // The only possible partner is this rank itself, whose part of the
+  // receive buffer must not be modified if it is not a partner.
+  if ( not spike_send_partners_.empty() )
+  {
+    recv_buffer.swap( send_buffer );
+  }
+}
+
 #endif // HAVE_MPI
 
 template < class D >
@@ -806,8 +952,20 @@ MPIManager::communicate_spike_data_Alltoall( std::vector< D >& send_buffer,
   const size_t send_recv_count_spike_data_in_int_per_rank = sizeof( SpikeData )
     / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
 
-  communicate_Alltoall(
-    send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank );
+  if ( sparse_spike_exchange_ )
+  {
+    communicate_sparse(
+      send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank );
+    num_bytes_spike_data_sent_ += spike_send_partners_.size()
+      * send_recv_count_spike_data_in_int_per_rank * sizeof( unsigned int );
+  }
+  else
+  {
+    communicate_Alltoall(
+      send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank );
+    num_bytes_spike_data_sent_ += num_processes_
+      * send_recv_count_spike_data_in_int_per_rank * sizeof( unsigned int );
+  }
 }
 
 template < class D >
@@ -820,9 +978,56 @@ MPIManager::communicate_off_grid_spike_data_Alltoall(
     sizeof( OffGridSpikeData ) / sizeof( unsigned int )
     * send_recv_count_spike_data_per_rank_;
 
-  communicate_Alltoall( send_buffer,
+  if ( sparse_spike_exchange_ )
+  {
+    communicate_sparse( send_buffer,
+      recv_buffer,
+      send_recv_count_off_grid_spike_data_in_int_per_rank );
+    num_bytes_spike_data_sent_ += spike_send_partners_.size()
+      * send_recv_count_off_grid_spike_data_in_int_per_rank
+      * sizeof( unsigned int );
+  }
+  else
+  {
+    communicate_Alltoall( send_buffer,
+      recv_buffer,
+      send_recv_count_off_grid_spike_data_in_int_per_rank );
+    num_bytes_spike_data_sent_ += num_processes_
+      * send_recv_count_off_grid_spike_data_in_int_per_rank
+      * sizeof( unsigned int );
+  }
+}
+
+template < class D >
+void
+MPIManager::communicate_spike_data_Ialltoall( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_spike_data_in_int_per_rank = sizeof( SpikeData )
+    / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ialltoall(
+    send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank );
+  num_bytes_spike_data_sent_ += num_processes_
+    * send_recv_count_spike_data_in_int_per_rank * sizeof( unsigned int );
+}
+
+template < class D >
+void
+MPIManager::communicate_off_grid_spike_data_Ialltoall(
+  std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_off_grid_spike_data_in_int_per_rank =
+    sizeof( OffGridSpikeData ) / sizeof( unsigned int )
+    * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ialltoall( send_buffer,
     recv_buffer,
     send_recv_count_off_grid_spike_data_in_int_per_rank );
+  num_bytes_spike_data_sent_ += num_processes_
+    * send_recv_count_off_grid_spike_data_in_int_per_rank
+    * sizeof( unsigned int );
 }
 }
 
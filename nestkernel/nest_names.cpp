@@ -41,6 +41,7 @@ const Name Act_m( "Act_m" );
 const Name activity( "activity" );
 const Name adaptive_spike_buffers( "adaptive_spike_buffers" );
 const Name adaptive_target_buffers( "adaptive_target_buffers" );
+const Name aggregate_slice( "aggregate_slice" );
 const Name ahp_bug( "ahp_bug" );
 const Name allow_offgrid_spikes( "allow_offgrid_spikes" );
 const Name allow_offgrid_times( "allow_offgrid_times" );
@@ -56,13 +57,17 @@ const Name amplitude_values( "amplitude_values" );
 const Name Aplus( "Aplus" );
 const Name Aplus_triplet( "Aplus_triplet" );
 const Name archiver_length( "archiver_length" );
+const Name ascii( "ascii" );
+const Name asynchronous_output( "asynchronous_output" );
 const Name autapses( "autapses" );
 const Name available( "available" );
 
 const Name b( "b" );
+const Name batch_update( "batch_update" );
 const Name beta( "beta" );
 const Name beta_Ca( "beta_Ca" );
 const Name binary( "binary" );
+const Name bin_width( "bin_width" );
 const Name buffer_size_secondary_events( "buffer_size_secondary_events" );
 const Name buffer_size_spike_data( "buffer_size_spike_data" );
 const Name buffer_size_target_data( "buffer_size_target_data" );
@@ -79,9 +84,12 @@ const Name capacity( "capacity" );
 const Name clear( "clear" );
 const Name close_after_simulate( "close_after_simulate" );
 const Name close_on_reset( "close_on_reset" );
+const Name columnar( "columnar" );
+const Name compress_spike_data( "compress_spike_data" );
 const Name configbit_0( "configbit_0" );
 const Name configbit_1( "configbit_1" );
 const Name connection_count( "connection_count" );
+const Name connection_numa_nodes( "connection_numa_nodes" );
 const Name consistent_integration( "consistent_integration" );
 const Name continuous( "continuous" );
 const Name count_covariance( "count_covariance" );
@@ -147,9 +155,11 @@ const Name eta( "eta" );
 const Name events( "events" );
 const Name ex_spikes( "ex_spikes" );
 
+const Name fano_factor( "fano_factor" );
 const Name fbuffer_size( "fbuffer_size" );
 const Name file( "file" );
 const Name file_extension( "file_extension" );
+const Name file_format( "file_format" );
 const Name filenames( "filenames" );
 const Name flush_after_simulate( "flush_after_simulate" );
 const Name flush_records( "flush_records" );
@@ -227,6 +237,8 @@ const Name instantiations( "instantiations" );
 const Name Interpol_Order( "Interpol_Order" );
 const Name interval( "interval" );
 const Name is_refractory( "is_refractory" );
+const Name isi_cv( "isi_cv" );
+const Name isi_mean( "isi_mean" );
 
 const Name keep_source_table( "keep_source_table" );
 const Name Kplus( "Kplus" );
@@ -274,17 +286,24 @@ const Name n_events( "n_events" );
 const Name n_messages( "n_messages" );
 const Name n_proc( "n_proc" );
 const Name n_receptors( "n_receptors" );
+const Name n_senders( "n_senders" );
+const Name n_spikes( "n_spikes" );
 const Name n_synapses( "n_synapses" );
 const Name network_size( "network_size" );
 const Name neuron( "neuron" );
 const Name next_readout_time( "next_readout_time" );
 const Name NMDA( "NMDA" );
 const Name no_synapses( "no_synapses" );
+const Name node_numa_nodes( "node_numa_nodes" );
 const Name node_uses_wfr( "node_uses_wfr" );
 const Name noise( "noise" );
 const Name noisy_rate( "noisy_rate" );
+const Name num_bytes_spike_data_sent( "num_bytes_spike_data_sent" );
 const Name num_connections( "num_connections" );
 const Name num_processes( "num_processes" );
+const Name num_spike_buffer_resizes( "num_spike_buffer_resizes" );
+const Name num_spike_data_gathers( "num_spike_data_gathers" );
+const Name num_spike_data_rounds( "num_spike_data_rounds" );
 const Name number_of_children( "number_of_children" );
 
 const Name off_grid_spiking( "off_grid_spiking" );
@@ -295,6 +314,11 @@ const Name order( "order" );
 const Name origin( "origin" );
 const Name other( "other" );
 const Name outdegree( "outdegree" );
+const Name output_bytes_written( "output_bytes_written" );
+const Name output_queue_size( "output_queue_size" );
+const Name output_wait_time( "output_wait_time" );
+const Name output_write_time( "output_write_time" );
+const Name overlap_spike_communication( "overlap_spike_communication" );
 const Name overwrite_files( "overwrite_files" );
 
 const Name p( "p" );
@@ -326,6 +350,7 @@ const Name q_stc( "q_stc" );
 const Name rate( "rate" );
 const Name rate_times( "rate_times" );
 const Name rate_values( "rate_values" );
+const Name rates( "rates" );
 const Name readout_cycle_duration( "readout_cycle_duration" );
 const Name receptor_type( "receptor_type" );
 const Name receptor_types( "receptor_types" );
@@ -356,19 +381,27 @@ const Name senders( "senders" );
 const Name shift_now_spikes( "shift_now_spikes" );
 const Name sigma( "sigma" );
 const Name sigmoid( "sigmoid" );
+const Name single_precision( "single_precision" );
 const Name size_of( "sizeof" );
 const Name soma_curr( "soma_curr" );
 const Name soma_exc( "soma_exc" );
 const Name soma_inh( "soma_inh" );
 const Name sort_connections_by_source( "sort_connections_by_source" );
 const Name source( "source" );
+const Name sparse_spike_exchange( "sparse_spike_exchange" );
 const Name spike( "spike" );
+const Name spike_buffer_grow_extra( "spike_buffer_grow_extra" );
+const Name spike_buffer_shrink_delay( "spike_buffer_shrink_delay" );
+const Name spike_buffer_shrink_limit( "spike_buffer_shrink_limit" );
 const Name spike_multiplicities( "spike_multiplicities" );
+const Name spike_recv_partners( "spike_recv_partners" );
+const Name spike_send_partners( "spike_send_partners" );
 const Name spike_times( "spike_times" );
 const Name spike_weights( "spike_weights" );
 const Name start( "start" );
 const Name std( "std" );
 const Name std_mod( "std_mod" );
+const Name steps( "steps" );
 const Name stimulator( "stimulator" );
 const Name stop( "stop" );
 const Name structural_plasticity_synapses( "structural_plasticity_synapses" );
@@ -447,6 +480,7 @@ const Name theta_ex( "theta_ex" );
 const Name theta_in( "theta_in" );
 const Name thread( "thread" );
 const Name thread_local_id( "thread_local_id" );
+const Name thread_numa_nodes( "thread_numa_nodes" );
 const Name tics_per_ms( "tics_per_ms" );
 const Name tics_per_step( "tics_per_step" );
 const Name time( "time" );
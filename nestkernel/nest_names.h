@@ -62,6 +62,7 @@ extern const Name Act_m;
 extern const Name activity;
 extern const Name adaptive_spike_buffers;
 extern const Name adaptive_target_buffers;
+extern const Name aggregate_slice;
 extern const Name ahp_bug;
 extern const Name allow_offgrid_spikes;
 extern const Name allow_offgrid_times;
@@ -77,13 +78,17 @@ extern const Name amplitude_values;
 extern const Name Aplus;
 extern const Name Aplus_triplet;
 extern const Name archiver_length;
+extern const Name ascii;
+extern const Name asynchronous_output;
 extern const Name autapses;
 extern const Name available;
 
 extern const Name b;
+extern const Name batch_update;
 extern const Name beta;
 extern const Name beta_Ca;
 extern const Name binary;
+extern const Name bin_width;
 extern const Name buffer_size_secondary_events;
 extern const Name buffer_size_spike_data;
 extern const Name buffer_size_target_data;
@@ -100,9 +105,12 @@ extern const Name capacity;
 extern const Name clear;
 extern const Name close_after_simulate;
 extern const Name close_on_reset;
+extern const Name columnar;
+extern const Name compress_spike_data;
 extern const Name configbit_0;
 extern const Name configbit_1;
 extern const Name connection_count;
+extern const Name connection_numa_nodes;
 extern const Name consistent_integration;
 extern const Name continuous;
 extern const Name count_covariance;
@@ -168,9 +176,11 @@ extern const Name eta;
 extern const Name events;
 extern const Name ex_spikes;
 
+extern const Name fano_factor;
 extern const Name fbuffer_size;
 extern const Name file;
 extern const Name file_extension;
+extern const Name file_format;
 extern const Name filenames;
 extern const Name flush_after_simulate;
 extern const Name flush_records;
@@ -247,6 +257,8 @@ extern const Name instantiations;
 extern const Name Interpol_Order;
 extern const Name interval;
 extern const Name is_refractory;
+extern const Name isi_cv;
+extern const Name isi_mean;
 
 extern const Name keep_source_table;
 extern const Name Kplus;
@@ -294,17 +306,24 @@ extern const Name n_events;
 extern const Name n_messages;
 extern const Name n_proc;
 extern const Name n_receptors;
+extern const Name n_senders;
+extern const Name n_spikes;
 extern const Name n_synapses;
 extern const Name network_size;
 extern const Name neuron;
 extern const Name next_readout_time;
 extern const Name NMDA;
 extern const Name no_synapses;
+extern const Name node_numa_nodes;
 extern const Name node_uses_wfr;
 extern const Name noise;
 extern const Name noisy_rate;
+extern const Name num_bytes_spike_data_sent;
 extern const Name num_connections;
 extern const Name num_processes;
+extern const Name num_spike_buffer_resizes;
+extern const Name num_spike_data_gathers;
+extern const Name num_spike_data_rounds;
 extern const Name number_of_children;
 
 extern const Name off_grid_spiking;
@@ -315,6 +334,11 @@ extern const Name order;
 extern const Name origin;
 extern const Name other;
 extern const Name outdegree;
+extern const Name output_bytes_written;
+extern const Name output_queue_size;
+extern const Name output_wait_time;
+extern const Name output_write_time;
+extern const Name overlap_spike_communication;
 extern const Name overwrite_files;
 
 extern const Name p;
@@ -346,6 +370,7 @@ extern const Name q_stc;
 extern const Name rate;
 extern const Name rate_times;
 extern const Name rate_values;
+extern const Name rates;
 extern const Name readout_cycle_duration;
 extern const Name receptor_type;
 extern const Name receptor_types;
@@ -376,19 +401,27 @@ extern const Name senders;
 extern const Name shift_now_spikes;
 extern const Name sigma;
 extern const Name sigmoid;
+extern const Name single_precision;
 extern const Name size_of;
 extern const Name soma_curr;
 extern const Name soma_exc;
 extern const Name soma_inh;
 extern const Name sort_connections_by_source;
 extern const Name source;
+extern const Name sparse_spike_exchange;
 extern const Name spike;
+extern const Name spike_buffer_grow_extra;
+extern const Name spike_buffer_shrink_delay;
+extern const Name spike_buffer_shrink_limit;
 extern const Name spike_multiplicities;
+extern const Name spike_recv_partners;
+extern const Name spike_send_partners;
 extern const Name spike_times;
 extern const Name spike_weights;
 extern const Name start;
 extern const Name std;
 extern const Name std_mod;
+extern const Name steps;
 extern const Name stimulator;
 extern const Name stop;
 extern const Name structural_plasticity_synapses;
@@ -466,6 +499,7 @@ extern const Name theta_ex;
 extern const Name theta_in;
 extern const Name thread;
 extern const Name thread_local_id;
+extern const Name thread_numa_nodes;
 extern const Name tics_per_ms;
 extern const Name tics_per_step;
 extern const Name time;
@@ -215,6 +215,29 @@ Node::wfr_update( Time const&, const long, const long )
   throw UnexpectedEvent();
 }
 
+bool
+Node::supports_batch_update() const
+{
+  return false;
+}
+
+void
+Node::update_batch( std::vector< Node* >::const_iterator first,
+  std::vector< Node* >::const_iterator last,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  for ( std::vector< Node* >::const_iterator node = first; node != last;
+        ++node )
+  {
+    if ( not( *node )->is_frozen() )
+    {
+      ( *node )->update( origin, from, to );
+    }
+  }
+}
+
 /**
  * Default implementation of check_connection just throws UnexpectedEvent
  */
@@ -441,8 +464,8 @@ Node::get_K_values( double, double&, double& )
 void
 nest::Node::get_history( double,
   double,
-  std::deque< histentry >::iterator*,
-  std::deque< histentry >::iterator* )
+  SpikeHistory::iterator*,
+  SpikeHistory::iterator* )
 {
   throw UnexpectedEvent();
 }
@@ -25,7 +25,6 @@
 
 // C++ includes:
 #include <bitset>
-#include <deque>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -33,10 +32,10 @@
 
 // Includes from nestkernel:
 #include "event.h"
-#include "histentry.h"
 #include "nest_names.h"
 #include "nest_time.h"
 #include "nest_types.h"
+#include "spike_history.h"
 
 // Includes from sli:
 #include "dictdatum.h"
@@ -50,6 +49,8 @@ namespace nest
 class Model;
 class Subnet;
 class Archiving_Node;
+template < typename NodeT >
+class BatchUpdate;
 
 
 /**
@@ -337,6 +338,39 @@ public:
    */
   virtual bool wfr_update( Time const&, const long, const long );
 
+  /**
+   * Returns true if the node can update a range of nodes of its own
+   * model in a single call to update_batch().
+   *
+   * @see update_batch()
+   */
+  virtual bool supports_batch_update() const;
+
+  /**
+   * Bring all nodes in [first, last) from state $t$ to $t+n*dt$.
+   *
+   * All nodes in the range must be thread-local instances of the same
+   * model as this node. The result must be identical to calling update()
+   * on each node in the range that is not frozen, in the order of the
+   * range. This allows models to advance all their instances on a thread
+   * at once, with the state of all instances in contiguous arrays.
+   *
+   * Called by the SimulationManager only if the kernel property
+   * batch_update is set and supports_batch_update() returns true.
+   * The default implementation calls update() on each node.
+   *
+   * @param first  first node of the range
+   * @param last   one past the last node of the range
+   * @param Time   network time at beginning of time slice.
+   * @param long initial step inside time slice
+   * @param long post-final step inside time slice
+   */
+  virtual void update_batch( std::vector< Node* >::const_iterator first,
+    std::vector< Node* >::const_iterator last,
+    Time const&,
+    const long,
+    const long );
+
   /**
    * @defgroup status_interface Configuration interface.
    * Functions and infrastructure, responsible for the configuration
@@ -693,8 +727,8 @@ public:
   */
   virtual void get_history( double t1,
     double t2,
-    std::deque< histentry >::iterator* start,
-    std::deque< histentry >::iterator* finish );
+    SpikeHistory::iterator* start,
+    SpikeHistory::iterator* finish );
 
   /**
    * Modify Event object parameters during event delivery.
@@ -28,6 +28,7 @@
 // Includes from libnestutil:
 #include "compose.hpp"
 #include "logging.h"
+#include "numa_utils.h"
 
 // Includes from nestkernel:
 #include "event_delivery_manager.h"
@@ -248,11 +249,62 @@ index NodeManager::add_node( index mod, long n ) // no_p
     //       are for subnets and devices.
     local_nodes_.reserve( std::ceil( static_cast< double >( max_gid )
                             / kernel().mpi_manager.get_num_processes() ) + 50 );
-    for ( thread tid = 0; tid < n_threads; ++tid )
+    // Each thread allocates and initializes the nodes it owns from its own
+    // memory pool. Nodes are thus created in parallel and their memory is
+    // first touched by the thread updating them, which places it close to
+    // that thread on NUMA systems. The nodes are registered afterwards in
+    // order of their GIDs.
+    std::vector< std::vector< Node* > > new_nodes( n_threads );
+    std::vector< lockPTR< WrappedThreadException > > exceptions_raised(
+      n_threads );
+
+#ifdef _OPENMP
+#pragma omp parallel
     {
-      // Model::reserve() reserves memory for n ADDITIONAL nodes on thread t
-      // reserves at least one entry on each thread, nobody knows why
-      model->reserve_additional( tid, n_per_thread );
+      const thread t = kernel().vp_manager.get_thread_id();
+#else // clang-format off
+    for ( thread t = 0; t < n_threads; ++t )
+    {
+#endif // clang-format on
+      try
+      {
+        // Model::reserve() reserves memory for n ADDITIONAL nodes on thread t
+        // reserves at least one entry on each thread, nobody knows why
+        model->reserve_additional( t, n_per_thread );
+        new_nodes[ t ].reserve( n_per_thread );
+
+        // GIDs are distributed round-robin over the virtual processes
+        const thread vp = kernel().vp_manager.thread_to_vp( t );
+        const index n_vps = kernel().vp_manager.get_num_virtual_processes();
+        for ( index gid = min_gid + ( vp + n_vps - min_gid % n_vps ) % n_vps;
+              gid < max_gid;
+              gid += n_vps )
+        {
+          assert( kernel().vp_manager.suggest_vp_for_gid( gid ) == vp );
+
+          Node* newnode = model->allocate( t );
+          newnode->set_gid_( gid );
+          newnode->set_model_id( mod );
+          newnode->set_thread( t );
+          newnode->set_vp( vp );
+          new_nodes[ t ].push_back( newnode );
+        }
+      }
+      catch ( std::exception& e )
+      {
+        // so throw the exception after parallel region
+        exceptions_raised.at( t ) =
+          lockPTR< WrappedThreadException >( new WrappedThreadException( e ) );
+      }
+    } // end of parallel section / end of for threads
+
+    // check if any exceptions have been raised
+    for ( thread t = 0; t < n_threads; ++t )
+    {
+      if ( exceptions_raised.at( t ).valid() )
+      {
+        throw WrappedThreadException( *( exceptions_raised.at( t ) ) );
+      }
     }
 
     size_t gid;
@@ -274,6 +326,9 @@ index NodeManager::add_node( index mod, long n ) // no_p
     // become irrelevant.
     current_->add_gid_range( min_gid, max_gid - 1 );
 
+    // position of the next node to register in new_nodes, for each thread
+    std::vector< size_t > next_new_node( n_threads, 0 );
+
     // min_gid is first valid gid i should create, hence ask for the first local
     // gid after min_gid-1
     while ( gid < max_gid )
@@ -283,11 +338,8 @@ index NodeManager::add_node( index mod, long n ) // no_p
 
       if ( kernel().vp_manager.is_local_vp( vp ) )
       {
-        Node* newnode = model->allocate( t );
-        newnode->set_gid_( gid );
-        newnode->set_model_id( mod );
-        newnode->set_thread( t );
-        newnode->set_vp( vp );
+        Node* newnode = new_nodes[ t ][ next_new_node[ t ]++ ];
+        assert( newnode->get_gid() == gid );
 
         local_nodes_.add_local_node( *newnode ); // put into local nodes list
         current_->add_node( newnode ); // and into current subnet, thread 0.
@@ -966,6 +1018,24 @@ NodeManager::get_status( DictionaryDatum& d )
     s << cit->first;
     ( *cdict )[ s.str() ] = cit->second;
   }
+
+  // NUMA node of the first local node of each thread
+  const thread n_threads = kernel().vp_manager.get_num_threads();
+  std::vector< long > node_numa_nodes( n_threads, -1 );
+  thread n_found = 0;
+  for ( size_t idx = 0; idx < local_nodes_.size() and n_found < n_threads;
+        ++idx )
+  {
+    const Node* node = local_nodes_.get_node_by_index( idx );
+    if ( node != 0 and node->has_proxies()
+      and node_numa_nodes[ node->get_thread() ] == -1 )
+    {
+      node_numa_nodes[ node->get_thread() ] = numa_node_of_address( node );
+      ++n_found;
+    }
+  }
+  ArrayDatum node_numa_nodes_ad( node_numa_nodes );
+  def< ArrayDatum >( d, names::node_numa_nodes, node_numa_nodes_ad );
 }
 
 void
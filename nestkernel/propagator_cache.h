@@ -0,0 +1,153 @@
+/*
+ *  propagator_cache.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PROPAGATOR_CACHE_H
+#define PROPAGATOR_CACHE_H
+
+// C++ includes:
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Cache of propagators shared by all nodes of a model with identical
+ * parameters.
+ *
+ * Models using exact integration compute their propagators in calibrate().
+ * Large populations usually share time constants, capacitance and
+ * resolution, so instead of computing and storing the propagators per node,
+ * nodes obtain a shared, immutable entry from a cache held by the model.
+ * Entries are keyed by all values the propagators depend on, including
+ * the resolution, and are released when the last node referring to them
+ * is destroyed or recalibrated with different parameters.
+ *
+ * Lookups are thread-safe, since calibrate() is called in parallel.
+ */
+template < typename PropagatorsT >
+class PropagatorCache
+{
+public:
+  typedef std::vector< double > Key;
+  typedef std::shared_ptr< const PropagatorsT > Entry;
+
+  PropagatorCache();
+
+  //! Return entry for key, or an empty entry if key is not cached
+  Entry find( const Key& key );
+
+  /**
+   * Add propagators for key to the cache and return the cached entry.
+   * If another thread has added an entry for key in the meantime, this
+   * entry is returned instead.
+   */
+  Entry insert( const Key& key, const PropagatorsT& propagators );
+
+private:
+  //! Remove entries no longer referred to by any node
+  void purge_();
+
+  std::map< Key, std::weak_ptr< const PropagatorsT > > entries_;
+
+  //! Number of entries at which released entries are purged
+  size_t purge_threshold_;
+};
+
+template < typename PropagatorsT >
+PropagatorCache< PropagatorsT >::PropagatorCache()
+  : entries_()
+  , purge_threshold_( 16 )
+{
+}
+
+template < typename PropagatorsT >
+typename PropagatorCache< PropagatorsT >::Entry
+PropagatorCache< PropagatorsT >::find( const Key& key )
+{
+  Entry entry;
+#pragma omp critical( propagator_cache )
+  {
+    typename std::map< Key, std::weak_ptr< const PropagatorsT > >::
+      const_iterator it = entries_.find( key );
+    if ( it != entries_.end() )
+    {
+      entry = it->second.lock();
+    }
+  }
+  return entry;
+}
+
+template < typename PropagatorsT >
+typename PropagatorCache< PropagatorsT >::Entry
+PropagatorCache< PropagatorsT >::insert( const Key& key,
+  const PropagatorsT& propagators )
+{
+  // allocate outside of the critical region, entry is dropped if another
+  // thread was faster
+  Entry new_entry = std::make_shared< const PropagatorsT >( propagators );
+  Entry entry;
+#pragma omp critical( propagator_cache )
+  {
+    std::weak_ptr< const PropagatorsT >& cached = entries_[ key ];
+    entry = cached.lock();
+    if ( not entry )
+    {
+      entry = new_entry;
+      cached = entry;
+
+      // with heterogeneous parameters, entries are released when nodes are
+      // recalibrated; purge them once the map has doubled in size
+      if ( entries_.size() >= purge_threshold_ )
+      {
+        purge_();
+        purge_threshold_ = std::max< size_t >( 16, 2 * entries_.size() );
+      }
+    }
+  }
+  return entry;
+}
+
+template < typename PropagatorsT >
+void
+PropagatorCache< PropagatorsT >::purge_()
+{
+  typename std::map< Key, std::weak_ptr< const PropagatorsT > >::iterator
+    it = entries_.begin();
+  while ( it != entries_.end() )
+  {
+    if ( it->second.expired() )
+    {
+      entries_.erase( it++ );
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+} // namespace nest
+
+#endif /* PROPAGATOR_CACHE_H */
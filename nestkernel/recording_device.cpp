@@ -74,6 +74,8 @@ nest::RecordingDevice::Parameters_::Parameters_( const std::string& file_ext,
   , user_set_precision_( false )
   , binary_( false )
   , fbuffer_size_( -1 ) // -1 marks use of default buffer
+  , columnar_( false )
+  , single_precision_( false )
   , label_()
   , file_ext_( file_ext )
   , filename_()
@@ -158,6 +160,9 @@ nest::RecordingDevice::Parameters_::get( const RecordingDevice& rd,
 
   ( *d )[ names::binary ] = binary_;
   ( *d )[ names::fbuffer_size ] = fbuffer_size_;
+  ( *d )[ names::file_format ] =
+    LiteralDatum( columnar_ ? names::columnar : names::ascii );
+  ( *d )[ names::single_precision ] = single_precision_;
 
   ( *d )[ names::close_after_simulate ] = close_after_simulate_;
   ( *d )[ names::flush_after_simulate ] = flush_after_simulate_;
@@ -223,6 +228,24 @@ nest::RecordingDevice::Parameters_::set( const RecordingDevice& rd,
     fbuffer_size_ = fbuffer_size;
   }
 
+  std::string file_format;
+  if ( updateValue< std::string >( d, names::file_format, file_format ) )
+  {
+    if ( file_format != names::ascii.toString()
+      and file_format != names::columnar.toString() )
+    {
+      throw BadProperty( "file_format must be /ascii or /columnar." );
+    }
+
+    const bool columnar = file_format == names::columnar.toString();
+    if ( columnar != columnar_ and B.fs_.is_open() )
+    {
+      throw BadProperty( "file_format cannot be changed on open files." );
+    }
+    columnar_ = columnar;
+  }
+  updateValue< bool >( d, names::single_precision, single_precision_ );
+
   updateValue< bool >( d, names::close_after_simulate, close_after_simulate_ );
   updateValue< bool >( d, names::flush_after_simulate, flush_after_simulate_ );
   updateValue< bool >( d, names::flush_records, flush_records_ );
@@ -467,11 +490,32 @@ nest::RecordingDevice::Buffers_::Buffers_()
   : fs_()
   , fbuffer_( 0 )
   , fbuffer_size_( -1 )
+  , columns_()
+  , value_names_()
+  , async_( false )
+  , obuf_()
+  , os_( &obuf_ )
+  , block_()
 {
 }
 
 nest::RecordingDevice::Buffers_::~Buffers_()
 {
+  // output still buffered would otherwise be lost when fs_ is closed
+  if ( fs_.is_open() )
+  {
+    if ( async_ )
+    {
+      columns_.write_chunk( os_ );
+      obuf_.swap( block_ );
+      kernel().io_manager.get_output_writer().submit( fs_, block_, false );
+      kernel().io_manager.get_output_writer().wait();
+    }
+    else
+    {
+      columns_.write_chunk( fs_ );
+    }
+  }
   if ( fbuffer_ )
   {
     delete[] fbuffer_;
@@ -548,6 +592,7 @@ nest::RecordingDevice::init_buffers()
   // as long as B_.fs_ exists.
   if ( P_.close_on_reset_ and B_.fs_.is_open() )
   {
+    write_buffered_output_();
     B_.fs_.close();
     P_.filename_.clear(); // filename_ only visible while file open
   }
@@ -560,6 +605,15 @@ nest::RecordingDevice::calibrate()
 
   if ( P_.to_file_ )
   {
+    // output collected so far must reach the file before switching between
+    // synchronous and asynchronous writing
+    const bool async = kernel().io_manager.asynchronous_output();
+    if ( async != B_.async_ )
+    {
+      write_buffered_output_();
+      B_.async_ = async;
+    }
+
     // do we need to (re-)open the file
     bool newfile = false;
 
@@ -577,6 +631,7 @@ nest::RecordingDevice::calibrate()
           "Closing file '%1', opening file '%2'", P_.filename_, newname );
         LOG( M_INFO, "RecordingDevice::calibrate()", msg );
 
+        write_buffered_output_();
         B_.fs_.close(); // close old file
         P_.filename_ = newname;
         newfile = true;
@@ -623,7 +678,7 @@ nest::RecordingDevice::calibrate()
 
       if ( kernel().io_manager.overwrite_files() )
       {
-        if ( P_.binary_ )
+        if ( P_.binary_ or P_.columnar_ )
         {
           B_.fs_.open( P_.filename_.c_str(), std::ios::out | std::ios::binary );
         }
@@ -652,7 +707,7 @@ nest::RecordingDevice::calibrate()
         }
 
         // file does not exist, so we can open
-        if ( P_.binary_ )
+        if ( P_.binary_ or P_.columnar_ )
         {
           B_.fs_.open( P_.filename_.c_str(), std::ios::out | std::ios::binary );
         }
@@ -695,6 +750,29 @@ nest::RecordingDevice::calibrate()
     }
 
     B_.fs_ << std::setprecision( P_.precision_ );
+    B_.os_.copyfmt( B_.fs_ );
+
+    if ( P_.columnar_ )
+    {
+      if ( newfile )
+      {
+        setup_columns_( B_.columns_ );
+        B_.columns_.write_header(
+          file_stream_(), Time::get_resolution().get_ms() );
+      }
+      else
+      {
+        // the header of the open file must describe the records to come
+        ColumnarFileWriter columns;
+        setup_columns_( columns );
+        if ( not columns.has_same_columns( B_.columns_ ) )
+        {
+          throw BadProperty(
+            "Recorded properties cannot be changed while a file in columnar "
+            "format is open. Set /to_file to false to close the file." );
+        }
+      }
+    }
   }
 }
 
@@ -705,8 +783,14 @@ nest::RecordingDevice::post_run_cleanup()
   {
     if ( P_.flush_after_simulate_ )
     {
+      write_buffered_output_();
       B_.fs_.flush();
     }
+    else if ( B_.async_ )
+    {
+      // B_.fs_ must not be accessed while the writer thread uses it
+      kernel().io_manager.get_output_writer().wait();
+    }
 
     if ( not B_.fs_.good() )
     {
@@ -726,14 +810,20 @@ nest::RecordingDevice::finalize()
   {
     if ( P_.close_after_simulate_ )
     {
+      write_buffered_output_();
       B_.fs_.close();
       return;
     }
 
     if ( P_.flush_after_simulate_ )
     {
+      write_buffered_output_();
       B_.fs_.flush();
     }
+    else if ( B_.async_ )
+    {
+      kernel().io_manager.get_output_writer().wait();
+    }
     if ( not B_.fs_.good() )
     {
       std::string msg =
@@ -769,6 +859,7 @@ nest::RecordingDevice::set_status( const DictionaryDatum& d )
 
   if ( not P_.to_file_ and B_.fs_.is_open() )
   {
+    write_buffered_output_();
     B_.fs_.close();
     P_.filename_.clear();
   }
@@ -820,18 +911,29 @@ nest::RecordingDevice::record_event( const Event& event, bool endrecord )
     }
   }
 
-  if ( P_.to_file_ )
+  if ( P_.to_file_ and P_.columnar_ )
   {
-    print_id_( B_.fs_, sender );
-    print_target_( B_.fs_, target );
-    print_port_( B_.fs_, port );
-    print_rport_( B_.fs_, rport );
-    print_time_( B_.fs_, stamp, offset );
-    print_weight_( B_.fs_, weight );
+    put_columns_(
+      sender, target, port, rport, stamp.get_steps(), offset, weight );
     if ( endrecord )
     {
-      B_.fs_ << '\n';
-      if ( P_.flush_records_ )
+      end_row_();
+    }
+  }
+  else if ( P_.to_file_ )
+  {
+    std::ostream& os = file_stream_();
+    print_id_( os, sender );
+    print_target_( os, target );
+    print_port_( os, port );
+    print_rport_( os, rport );
+    print_time_( os, stamp, offset );
+    print_weight_( os, weight );
+    if ( endrecord )
+    {
+      os << '\n';
+      // asynchronous output is flushed by end_slice()
+      if ( P_.flush_records_ and not B_.async_ )
       {
         B_.fs_.flush();
       }
@@ -846,6 +948,264 @@ nest::RecordingDevice::record_event( const Event& event, bool endrecord )
   }
 }
 
+void
+nest::RecordingDevice::SpikeRecords::clear()
+{
+  // clear() keeps the capacity of the vectors
+  senders.clear();
+  steps.clear();
+  offsets.clear();
+  weights.clear();
+  ports.clear();
+}
+
+void
+nest::RecordingDevice::record_spikes( const SpikeRecords& spikes )
+{
+  const size_t n_spikes = spikes.size();
+  if ( n_spikes == 0 )
+  {
+    return;
+  }
+  S_.events_ += n_spikes;
+
+  if ( P_.to_screen_ )
+  {
+    print_spikes_( std::cout, spikes, false );
+  }
+
+  if ( P_.to_file_ and P_.columnar_ )
+  {
+    for ( size_t i = 0; i < n_spikes; ++i )
+    {
+      put_columns_( spikes.senders[ i ],
+        node_.get_gid(),
+        spikes.ports[ i ],
+        0,
+        spikes.steps[ i ],
+        spikes.offsets[ i ],
+        spikes.weights[ i ] );
+      end_row_();
+    }
+  }
+  else if ( P_.to_file_ )
+  {
+    print_spikes_(
+      file_stream_(), spikes, P_.flush_records_ and not B_.async_ );
+  }
+
+  if ( P_.to_memory_ or P_.to_accumulator_ )
+  {
+    if ( P_.withgid_ )
+    {
+      S_.event_senders_.insert( S_.event_senders_.end(),
+        spikes.senders.begin(),
+        spikes.senders.end() );
+    }
+    if ( P_.withtime_ )
+    {
+      if ( P_.time_in_steps_ )
+      {
+        S_.event_times_steps_.insert(
+          S_.event_times_steps_.end(), spikes.steps.begin(), spikes.steps.end() );
+        if ( P_.precise_times_ )
+        {
+          S_.event_times_offsets_.insert( S_.event_times_offsets_.end(),
+            spikes.offsets.begin(),
+            spikes.offsets.end() );
+        }
+      }
+      else
+      {
+        S_.event_times_ms_.reserve( S_.event_times_ms_.size() + n_spikes );
+        for ( size_t i = 0; i < n_spikes; ++i )
+        {
+          const double t = Time( Time::step( spikes.steps[ i ] ) ).get_ms();
+          S_.event_times_ms_.push_back(
+            P_.precise_times_ ? t - spikes.offsets[ i ] : t );
+        }
+      }
+    }
+    if ( P_.withweight_ )
+    {
+      S_.event_weights_.insert( S_.event_weights_.end(),
+        spikes.weights.begin(),
+        spikes.weights.end() );
+    }
+    if ( P_.withtargetgid_ )
+    {
+      S_.event_targets_.insert(
+        S_.event_targets_.end(), n_spikes, node_.get_gid() );
+    }
+    if ( P_.withport_ )
+    {
+      S_.event_ports_.insert(
+        S_.event_ports_.end(), spikes.ports.begin(), spikes.ports.end() );
+    }
+    if ( P_.withrport_ )
+    {
+      S_.event_rports_.insert( S_.event_rports_.end(), n_spikes, 0 );
+    }
+  }
+}
+
+void
+nest::RecordingDevice::print_spikes_( std::ostream& os,
+  const SpikeRecords& spikes,
+  bool flush )
+{
+  for ( size_t i = 0; i < spikes.size(); ++i )
+  {
+    print_id_( os, spikes.senders[ i ] );
+    print_target_( os, node_.get_gid() );
+    print_port_( os, spikes.ports[ i ] );
+    print_rport_( os, 0 );
+    print_time_(
+      os, Time( Time::step( spikes.steps[ i ] ) ), spikes.offsets[ i ] );
+    print_weight_( os, spikes.weights[ i ] );
+    os << '\n';
+    if ( flush )
+    {
+      os.flush();
+    }
+  }
+}
+
+void
+nest::RecordingDevice::set_value_names( const std::vector< Name >& names )
+{
+  B_.value_names_ = names;
+}
+
+void
+nest::RecordingDevice::setup_columns_( ColumnarFileWriter& columns ) const
+{
+  const ColumnarFileWriter::ColumnType value_type = P_.single_precision_
+    ? ColumnarFileWriter::FLOAT32
+    : ColumnarFileWriter::FLOAT64;
+
+  columns.clear_columns();
+  if ( P_.withgid_ )
+  {
+    columns.add_column( names::senders.toString(), ColumnarFileWriter::UINT64 );
+  }
+  if ( P_.withtargetgid_ )
+  {
+    columns.add_column( names::targets.toString(), ColumnarFileWriter::UINT64 );
+  }
+  if ( P_.withport_ )
+  {
+    columns.add_column( names::ports.toString(), ColumnarFileWriter::INT64 );
+  }
+  if ( P_.withrport_ )
+  {
+    columns.add_column( names::rports.toString(), ColumnarFileWriter::INT64 );
+  }
+  if ( P_.withtime_ )
+  {
+    columns.add_column( names::steps.toString(), ColumnarFileWriter::INT64 );
+    if ( P_.precise_times_ )
+    {
+      // offsets are always stored in double precision to keep times exact
+      columns.add_column(
+        names::offsets.toString(), ColumnarFileWriter::FLOAT64 );
+    }
+  }
+  if ( P_.withweight_ )
+  {
+    columns.add_column( names::weights.toString(), value_type );
+  }
+  for ( size_t v = 0; v < B_.value_names_.size(); ++v )
+  {
+    columns.add_column( B_.value_names_[ v ].toString(), value_type );
+  }
+}
+
+void
+nest::RecordingDevice::put_columns_( index sender,
+  index target,
+  long port,
+  long rport,
+  long step,
+  double offset,
+  double weight )
+{
+  if ( P_.withgid_ )
+  {
+    B_.columns_.put( sender );
+  }
+  if ( P_.withtargetgid_ )
+  {
+    B_.columns_.put( target );
+  }
+  if ( P_.withport_ )
+  {
+    B_.columns_.put( port );
+  }
+  if ( P_.withrport_ )
+  {
+    B_.columns_.put( rport );
+  }
+  if ( P_.withtime_ )
+  {
+    B_.columns_.put( step );
+    if ( P_.precise_times_ )
+    {
+      B_.columns_.put( offset );
+    }
+  }
+  if ( P_.withweight_ )
+  {
+    B_.columns_.put( weight );
+  }
+}
+
+void
+nest::RecordingDevice::end_row_()
+{
+  if ( B_.columns_.end_row() or P_.flush_records_ )
+  {
+    B_.columns_.write_chunk( file_stream_() );
+    if ( P_.flush_records_ and not B_.async_ )
+    {
+      B_.fs_.flush();
+    }
+  }
+}
+
+void
+nest::RecordingDevice::end_slice()
+{
+  if ( B_.async_ and B_.obuf_.size() > 0
+    and ( P_.flush_records_ or B_.obuf_.size() >= output_block_size_ ) )
+  {
+    hand_off_output_( P_.flush_records_ );
+  }
+}
+
+void
+nest::RecordingDevice::hand_off_output_( bool flush )
+{
+  B_.obuf_.swap( B_.block_ );
+  kernel().io_manager.get_output_writer().submit( B_.fs_, B_.block_, flush );
+}
+
+void
+nest::RecordingDevice::write_buffered_output_()
+{
+  if ( not B_.fs_.is_open() )
+  {
+    return;
+  }
+
+  B_.columns_.write_chunk( file_stream_() );
+  if ( B_.async_ )
+  {
+    hand_off_output_( false );
+    kernel().io_manager.get_output_writer().wait();
+  }
+}
+
 void
 nest::RecordingDevice::print_id_( std::ostream& os, index gid )
 {
@@ -31,6 +31,8 @@
 #include "lockptr.h"
 
 // Includes from nestkernel:
+#include "async_output_writer.h"
+#include "columnar_file_writer.h"
 #include "device.h"
 #include "nest_types.h"
 
@@ -177,6 +179,20 @@ namespace nest
   /binary        - if set to true, data is written in binary mode to files
                    instead of ASCII. This setting affects file output only, not
                    screen output (default: false)
+  /file_format   - format of files written: /ascii writes one line of text per
+                   record, /columnar writes the binary columnar format, which
+                   stores GIDs as uint64, ports and times as int64 steps,
+                   offsets of precise times as float64, and weights and
+                   recorded values as float64 (see /single_precision) in one
+                   column each. Files start with a header describing the
+                   columns and the resolution. Records are buffered
+                   in memory and written in large chunks. /time_in_steps,
+                   /scientific and /precision do not apply. Use the functions
+                   in PyNEST module nest.columnar to read the files. Cannot be
+                   changed while the file is open (default: /ascii).
+  /single_precision - if set to true, weights and recorded values are stored
+                   as float32 instead of float64 in columnar files
+                   (default: false)
   /fbuffer_size  - the size of the buffer to use for writing to files. Setting
                    this value to 0 will reduce buffering to a system-dependent
                    minimum. Set /flush_after_simulate to true to ensure that all
@@ -316,6 +332,16 @@ public:
    */
   void finalize();
 
+  /**
+   * Hand file output to the writer thread if writing asynchronously.
+   *
+   * Must be called by the owning device at the end of each update(). The
+   * output collected is handed over if it exceeds output_block_size_ or
+   * if records are to be flushed.
+   * @see IOManager::asynchronous_output()
+   */
+  void end_slice();
+
   /**
    * Record common information for one event.
    *
@@ -329,6 +355,54 @@ public:
    */
   void record_event( const Event&, bool endrecord = true );
 
+  /**
+   * Spikes buffered for recording, stored column-wise.
+   *
+   * Devices recording spikes collect the spikes they receive in this
+   * buffer instead of storing a copy of each SpikeEvent. The buffer keeps
+   * its capacity when cleared, so that no memory is allocated once it has
+   * grown to the number of spikes received per time slice.
+   */
+  struct SpikeRecords
+  {
+    std::vector< long > senders;  //!< GIDs of the senders
+    std::vector< long > steps;    //!< time stamps in steps
+    std::vector< double > offsets; //!< offsets of precise spike times
+    std::vector< double > weights; //!< weights of the spikes
+    std::vector< long > ports;     //!< ports of the spikes
+
+    void
+    push_back( const index sender,
+      const long step,
+      const double offset,
+      const double weight,
+      const long port )
+    {
+      senders.push_back( sender );
+      steps.push_back( step );
+      offsets.push_back( offset );
+      weights.push_back( weight );
+      ports.push_back( port );
+    }
+
+    size_t
+    size() const
+    {
+      return senders.size();
+    }
+
+    void clear();
+  };
+
+  /**
+   * Record all spikes in the given buffer.
+   *
+   * The spikes are handled as if passed one by one to record_event(),
+   * but are stored in memory in bulk. The target of each spike is the
+   * recording device itself, its rport is zero.
+   */
+  void record_spikes( const SpikeRecords& );
+
   /**
    * Print single item of type ValueT.
    *
@@ -337,6 +411,14 @@ public:
   template < typename ValueT >
   void print_value( const ValueT&, bool endrecord = true );
 
+  /**
+   * Set the names of the values passed to print_value() for each record.
+   *
+   * The names label the value columns of files in columnar format. Must
+   * be called before calibrate().
+   */
+  void set_value_names( const std::vector< Name >& );
+
   /** Indicate if recording device is active.
    *  The argument is the time stamp of the event, and the
    *  device is active if start_ < T <= stop_.
@@ -442,6 +524,57 @@ private:
    */
   void print_rport_( std::ostream&, long );
 
+  /**
+   * Print all spikes in the buffer to the given stream.
+   * @param flush pass true to flush the stream after each record
+   */
+  void print_spikes_( std::ostream&, const SpikeRecords&, bool flush );
+
+  /**
+   * Define the columns of files in columnar format according to the
+   * recorder's flags and the value names.
+   */
+  void setup_columns_( ColumnarFileWriter& ) const;
+
+  /**
+   * Append the common information of one event to the current row of the
+   * columnar file, in the order of the columns defined by setup_columns_().
+   */
+  void put_columns_( index sender,
+    index target,
+    long port,
+    long rport,
+    long step,
+    double offset,
+    double weight );
+
+  /**
+   * Complete the current row of the columnar file and write the buffered
+   * rows if the buffer is full or records are to be flushed.
+   */
+  void end_row_();
+
+  /**
+   * Stream to write file output to: the file itself, or the buffer of
+   * output to be handed to the writer thread.
+   */
+  std::ostream& file_stream_();
+
+  /**
+   * Hand the output collected in B_.obuf_ to the writer thread.
+   * @param flush pass true to flush the file after writing
+   */
+  void hand_off_output_( bool flush );
+
+  /**
+   * Write all buffered file output (not std::cout).
+   *
+   * Writes rows buffered for the columnar format and, if writing
+   * asynchronously, waits until the writer thread has written all output.
+   * Afterwards, B_.fs_ may be accessed directly.
+   */
+  void write_buffered_output_();
+
   /**
    * Store data in internal structure.
    * @param store sender gid of event
@@ -487,6 +620,17 @@ private:
     char* fbuffer_;
     long fbuffer_size_; //!< size of fbuffer_; -1: not yet set
 
+    //! rows to be written to fs_ in columnar format
+    ColumnarFileWriter columns_;
+
+    //! names of values per record, see set_value_names()
+    std::vector< Name > value_names_;
+
+    bool async_;            //!< true if writing asynchronously
+    OutputBuffer obuf_;     //!< output collected for the writer thread
+    std::ostream os_;       //!< stream writing to obuf_
+    std::vector< char > block_; //!< block of output handed to writer thread
+
     Buffers_();
     ~Buffers_();
   };
@@ -518,6 +662,9 @@ private:
     bool binary_; //!< true if to write files in binary mode instead of ASCII
     long fbuffer_size_; //!< output buffer size; -1 until set by user
 
+    bool columnar_;         //!< true if to write files in columnar format
+    bool single_precision_; //!< true if to store values as float32
+
     std::string label_;    //!< a user-defined label for symbolic device names.
     std::string file_ext_; //!< the file name extension to use, without .
     std::string filename_; //!< the filename, if recording to a file (read-only)
@@ -582,6 +729,9 @@ private:
   Parameters_ P_;
   State_ S_;
   Buffers_ B_;
+
+  //! amount of output collected before handing it to the writer thread
+  static const size_t output_block_size_ = 1 << 20;
 };
 
 inline bool
@@ -632,6 +782,16 @@ RecordingDevice::set_precision( long precision )
   P_.precision_ = precision;
 }
 
+inline std::ostream&
+RecordingDevice::file_stream_()
+{
+  if ( B_.async_ )
+  {
+    return B_.os_;
+  }
+  return B_.fs_;
+}
+
 
 template < typename ValueT >
 void
@@ -648,10 +808,21 @@ RecordingDevice::print_value( const ValueT& value, bool endrecord )
 
   if ( P_.to_file_ )
   {
-    B_.fs_ << value << '\t';
-    if ( endrecord )
+    if ( P_.columnar_ )
+    {
+      B_.columns_.put( value );
+      if ( endrecord )
+      {
+        end_row_();
+      }
+    }
+    else
     {
-      B_.fs_ << '\n';
+      file_stream_() << value << '\t';
+      if ( endrecord )
+      {
+        file_stream_() << '\n';
+      }
     }
   }
 }
@@ -111,6 +111,16 @@ public:
    */
   double get_value_wfr_update( const long offs );
 
+  /**
+   * Read and clear the values for the offsets from to to within the slice.
+   * @param  values  The value for offset from + k is written to
+   *                 values[ k * stride ].
+   */
+  void get_values( const long from,
+    const long to,
+    double* values,
+    const size_t stride );
+
   /**
    * Initialize the buffer with noughts.
    * Also resizes the buffer if necessary.
@@ -185,6 +195,30 @@ RingBuffer::get_value_wfr_update( const long offs )
   return val;
 }
 
+inline void
+RingBuffer::get_values( const long from,
+  const long to,
+  double* values,
+  const size_t stride )
+{
+  assert( 0 <= from and from <= to );
+  assert( ( delay ) to <= kernel().connection_manager.get_min_delay() );
+
+  // consecutive offsets are stored in consecutive elements, modulo the
+  // buffer size, so that the index is looked up only once
+  size_t idx = get_index_( from );
+  for ( long offs = from; offs < to; ++offs )
+  {
+    *values = buffer_[ idx ];
+    buffer_[ idx ] = 0.0; // clear buffer after reading
+    values += stride;
+    if ( ++idx == buffer_.size() )
+    {
+      idx = 0;
+    }
+  }
+}
+
 inline size_t
 RingBuffer::get_index_( const delay d ) const
 {
@@ -30,6 +30,7 @@
 
 // Includes from librandom:
 #include "gslrandomgen.h"
+#include "philox.h"
 #include "random_datums.h"
 
 // Includes from nestkernel:
@@ -156,8 +157,10 @@ nest::RNGManager::set_status( const DictionaryDatum& d )
 
       if ( kernel().vp_manager.is_local_vp( i ) )
       {
-        rng_[ kernel().vp_manager.vp_to_thread(
-                kernel().vp_manager.suggest_vp_for_gid( i ) ) ]->seed( s );
+        const thread vp = kernel().vp_manager.suggest_vp_for_gid( i );
+        librandom::RngPtr rng = rng_[ kernel().vp_manager.vp_to_thread( vp ) ];
+        rng->seed( s );
+        set_stream_( rng, vp, vp_rng_purpose_ );
       }
 
       rng_seeds_[ i ] = s;
@@ -209,6 +212,7 @@ nest::RNGManager::set_status( const DictionaryDatum& d )
     // now apply seed, resets generator automatically
     grng_seed_ = gseed;
     grng_->seed( gseed );
+    set_stream_( grng_, 0, global_rng_purpose_ );
 
   } // if grng_seed
 }
@@ -220,6 +224,18 @@ nest::RNGManager::get_status( DictionaryDatum& d )
   def< long >( d, names::grng_seed, grng_seed_ );
 }
 
+void
+nest::RNGManager::set_stream_( librandom::RngPtr rng,
+  const unsigned long vp,
+  const unsigned long purpose )
+{
+  librandom::Philox* philox = dynamic_cast< librandom::Philox* >( rng.get() );
+  if ( philox != 0 )
+  {
+    philox->set_stream( vp, purpose );
+  }
+  rng.unlock();
+}
 
 void
 nest::RNGManager::create_rngs_()
@@ -74,6 +74,22 @@ private:
   void create_rngs_();
   void create_grng_();
 
+  /**
+   * Select the stream of a counter-based generator (Philox) for the
+   * given virtual process and purpose, so that generators of different
+   * virtual processes are independent even if they have the same seed.
+   * Other generators are left unchanged.
+   */
+  void set_stream_( librandom::RngPtr rng,
+    const unsigned long vp,
+    const unsigned long purpose );
+
+  //! Purpose of the stream of the RNG of each virtual process
+  static const unsigned long vp_rng_purpose_ = 0;
+
+  //! Purpose of the stream of the global RNG
+  static const unsigned long global_rng_purpose_ = 1;
+
   /**
    * Vector of random number generators for threads.
    * There must be PRECISELY one rng per thread.
@@ -0,0 +1,98 @@
+/*
+ *  sampling_buffer.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "sampling_buffer.h"
+
+// C++ includes:
+#include <algorithm>
+
+nest::SamplingBuffer::SamplingBuffer()
+  : num_rows_( 0 )
+  , num_columns_( 0 )
+  , gids_()
+  , first_column_()
+  , num_vars_()
+  , num_samples_( 2 )
+  , timestamps_( 2 )
+  , data_( 2 )
+{
+}
+
+size_t
+nest::SamplingBuffer::add_node( const index gid, const size_t num_vars )
+{
+  const size_t first_column = gids_.empty()
+    ? 0
+    : first_column_.back() + num_vars_.back();
+
+  gids_.push_back( gid );
+  first_column_.push_back( first_column );
+  num_vars_.push_back( num_vars );
+  num_samples_[ 0 ].push_back( 0 );
+  num_samples_[ 1 ].push_back( 0 );
+
+  return gids_.size() - 1;
+}
+
+void
+nest::SamplingBuffer::resize( const size_t num_rows )
+{
+  const size_t num_columns =
+    gids_.empty() ? 0 : first_column_.back() + num_vars_.back();
+  const size_t new_num_rows = std::max( num_rows, num_rows_ );
+
+  if ( new_num_rows == num_rows_ and num_columns == num_columns_ )
+  {
+    return;
+  }
+
+  // Columns of new nodes are appended to each row, so existing samples
+  // are copied row by row into the new layout.
+  for ( size_t t = 0; t < 2; ++t )
+  {
+    std::vector< double > data( new_num_rows * num_columns );
+    for ( size_t row = 0; row < num_rows_; ++row )
+    {
+      std::copy( data_[ t ].begin() + row * num_columns_,
+        data_[ t ].begin() + ( row + 1 ) * num_columns_,
+        data.begin() + row * num_columns );
+    }
+    data_[ t ].swap( data );
+    timestamps_[ t ].resize( new_num_rows, Time::neg_inf() );
+  }
+
+  num_rows_ = new_num_rows;
+  num_columns_ = num_columns;
+}
+
+void
+nest::SamplingBuffer::clear()
+{
+  clear( 0 );
+  clear( 1 );
+}
+
+void
+nest::SamplingBuffer::clear( const size_t toggle )
+{
+  num_samples_[ toggle ].assign( num_samples_[ toggle ].size(), 0 );
+}
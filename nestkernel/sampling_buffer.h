@@ -0,0 +1,156 @@
+/*
+ *  sampling_buffer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SAMPLING_BUFFER_H
+#define SAMPLING_BUFFER_H
+
+// C++ includes:
+#include <cassert>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_time.h"
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Buffer for samples of state variables taken by data loggers.
+ *
+ * A multimeter owns one SamplingBuffer on each thread. The data loggers
+ * of all nodes the multimeter is connected to on that thread write their
+ * samples directly into the buffer, so that no DataLoggingRequest and
+ * DataLoggingReply events need to be exchanged during simulation.
+ *
+ * The buffer has one row per sample time in a time slice and one column
+ * per recorded variable of each node. Columns are assigned to nodes in
+ * the order in which they are connected. As in the data loggers, there
+ * are two sets of rows, which are selected by the read and write toggles
+ * of the EventDeliveryManager: nodes write the samples of the current
+ * time slice, while the multimeter reads those of the previous slice.
+ *
+ * All data loggers of a multimeter sample on the same time grid. Each
+ * node counts the samples it has written, so that nodes which have not
+ * been updated, e.g., because they are frozen, are skipped on read-out.
+ *
+ * @see UniversalDataLogger, Multimeter
+ */
+class SamplingBuffer
+{
+public:
+  SamplingBuffer();
+
+  /**
+   * Add columns for a node.
+   * @param gid GID of node recorded from
+   * @param num_vars number of variables recorded from node
+   * @return index of node in buffer
+   */
+  size_t add_node( const index gid, const size_t num_vars );
+
+  /**
+   * Provide space for the given number of samples per time slice.
+   * The buffer is never shrunk and samples not read yet are preserved.
+   */
+  void resize( const size_t num_rows );
+
+  //! Discard samples in both sets of rows
+  void clear();
+
+  //! Discard samples in the given set of rows
+  void clear( const size_t toggle );
+
+  /**
+   * Return pointer to the columns of the node in the next row.
+   * The caller must write all recorded variables of the node.
+   */
+  double* add_sample( const size_t toggle,
+    const size_t node,
+    const Time& stamp );
+
+  size_t
+  get_num_nodes() const
+  {
+    return gids_.size();
+  }
+
+  index
+  get_gid( const size_t node ) const
+  {
+    return gids_[ node ];
+  }
+
+  //! Number of samples written by the node to the given set of rows
+  size_t
+  get_num_samples( const size_t toggle, const size_t node ) const
+  {
+    return num_samples_[ toggle ][ node ];
+  }
+
+  const Time&
+  get_timestamp( const size_t toggle, const size_t row ) const
+  {
+    return timestamps_[ toggle ][ row ];
+  }
+
+  //! Return pointer to the values of the node in the given row
+  const double*
+  get_values( const size_t toggle, const size_t row, const size_t node ) const
+  {
+    return &data_[ toggle ][ row * num_columns_ + first_column_[ node ] ];
+  }
+
+private:
+  size_t num_rows_;    //!< number of rows in each set
+  size_t num_columns_; //!< number of columns allocated in data_
+
+  std::vector< index > gids_;          //!< GIDs of nodes
+  std::vector< size_t > first_column_; //!< first column of each node
+  std::vector< size_t > num_vars_;     //!< number of columns of each node
+
+  //! Number of samples written by each node, per toggle
+  std::vector< std::vector< size_t > > num_samples_;
+
+  //! Time stamps of rows, per toggle
+  std::vector< std::vector< Time > > timestamps_;
+
+  //! Samples stored row by row, per toggle
+  std::vector< std::vector< double > > data_;
+};
+
+inline double*
+SamplingBuffer::add_sample( const size_t toggle,
+  const size_t node,
+  const Time& stamp )
+{
+  size_t& row = num_samples_[ toggle ][ node ];
+  assert( row < num_rows_ );
+  assert( first_column_[ node ] + num_vars_[ node ] <= num_columns_ );
+
+  timestamps_[ toggle ][ row ] = stamp;
+  return &data_[ toggle ][ row++ * num_columns_ + first_column_[ node ] ];
+}
+
+} // namespace nest
+
+#endif // SAMPLING_BUFFER_H
@@ -24,6 +24,7 @@
 #define SEND_BUFFER_POSITION_H
 
 // C++ includes:
+#include <algorithm>
 #include <cassert>
 #include <vector>
 #include <limits>
@@ -45,6 +46,7 @@ private:
   std::vector< unsigned int > idx_;
   std::vector< unsigned int > begin_;
   std::vector< unsigned int > end_;
+  std::vector< unsigned int > num_rejected_;
 
   thread rank_to_index_( const thread rank ) const;
 
@@ -85,6 +87,18 @@ public:
 
   void increase( const thread rank );
 
+  /**
+   * Counts an entry for the specified rank that did not fit into the
+   * MPI buffer.
+   */
+  void reject( const thread rank );
+
+  /**
+   * Returns the largest number of entries, including rejected ones,
+   * destined for any of the ranks assigned to this thread.
+   */
+  unsigned int get_max_num_entries() const;
+
   const unsigned int send_recv_count_per_rank;
 };
 
@@ -98,6 +112,7 @@ inline SendBufferPosition::SendBufferPosition(
   idx_.resize( assigned_ranks.size );
   begin_.resize( assigned_ranks.size );
   end_.resize( assigned_ranks.size );
+  num_rejected_.resize( assigned_ranks.size, 0 );
   for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
   {
     // thread-local index of (global) rank
@@ -152,6 +167,24 @@ SendBufferPosition::increase( const thread rank )
   ++num_spike_data_written_;
 }
 
+inline void
+SendBufferPosition::reject( const thread rank )
+{
+  ++num_rejected_[ rank_to_index_( rank ) ];
+}
+
+inline unsigned int
+SendBufferPosition::get_max_num_entries() const
+{
+  unsigned int max_num_entries = 0;
+  for ( size_t lr_idx = 0; lr_idx < idx_.size(); ++lr_idx )
+  {
+    max_num_entries = std::max( max_num_entries,
+      idx_[ lr_idx ] - begin_[ lr_idx ] + num_rejected_[ lr_idx ] );
+  }
+  return max_num_entries;
+}
+
 } // namespace nest
 
 #endif /* SEND_BUFFER_POSITION_H */
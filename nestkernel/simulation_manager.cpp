@@ -54,6 +54,7 @@ nest::SimulationManager::SimulationManager()
   , exit_on_user_signal_( false )
   , inconsistent_state_( false )
   , print_time_( false )
+  , batch_update_( false )
   , use_wfr_( true )
   , wfr_comm_interval_( 1.0 )
   , wfr_tol_( 0.0001 )
@@ -74,6 +75,7 @@ nest::SimulationManager::initialize()
   simulated_ = false;
   exit_on_user_signal_ = false;
   inconsistent_state_ = false;
+  batch_update_ = false;
 }
 
 void
@@ -128,6 +130,7 @@ nest::SimulationManager::set_status( const DictionaryDatum& d )
   }
 
   updateValue< bool >( d, names::print_time, print_time_ );
+  updateValue< bool >( d, names::batch_update, batch_update_ );
 
   // tics_per_ms and resolution must come after local_num_thread /
   // total_num_threads because they might reset the network and the time
@@ -383,6 +386,7 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
   def< double >( d, names::time, get_time().get_ms() );
   def< long >( d, names::to_do, to_do_ );
   def< bool >( d, names::print_time, print_time_ );
+  def< bool >( d, names::batch_update, batch_update_ );
 
   def< bool >( d, names::use_wfr, use_wfr_ );
   def< double >( d, names::wfr_comm_interval, wfr_comm_interval_ );
@@ -687,8 +691,22 @@ nest::SimulationManager::call_update_()
 void
 nest::SimulationManager::update_connection_infrastructure( const thread tid )
 {
-  kernel().connection_manager.restructure_connection_tables( tid );
-  kernel().connection_manager.sort_connections( tid );
+#pragma omp single
+  {
+    kernel().connection_manager.check_incremental_update();
+  }
+
+  if ( kernel().connection_manager.is_incremental_update() )
+  {
+    // existing connections and the targets on the presynaptic side are
+    // kept, only new connections are sorted and communicated
+    kernel().connection_manager.sort_new_connections( tid );
+  }
+  else
+  {
+    kernel().connection_manager.restructure_connection_tables( tid );
+    kernel().connection_manager.sort_connections( tid );
+  }
 
 #pragma omp barrier // wait for all threads to finish sorting
 
@@ -731,6 +749,54 @@ nest::SimulationManager::update_connection_infrastructure( const thread tid )
   }
 }
 
+void
+nest::SimulationManager::update_nodes_( const thread tid,
+  const delay from,
+  const delay to,
+  std::vector< lockPTR< WrappedThreadException > >& exceptions_raised )
+{
+  const std::vector< Node* >& thread_local_nodes =
+    kernel().node_manager.get_nodes_on_thread( tid );
+  for ( std::vector< Node* >::const_iterator node = thread_local_nodes.begin();
+        node != thread_local_nodes.end(); )
+  {
+    // In batch mode, consecutive nodes of the same model are handed to
+    // the model in a single call.
+    std::vector< Node* >::const_iterator batch_end = node + 1;
+    if ( batch_update_ and ( *node )->supports_batch_update() )
+    {
+      const int model_id = ( *node )->get_model_id();
+      while ( batch_end != thread_local_nodes.end()
+        and ( *batch_end )->get_model_id() == model_id )
+      {
+        ++batch_end;
+      }
+    }
+
+    // We update in a parallel region. Therefore, we need to catch
+    // exceptions here and then handle them after the parallel region.
+    try
+    {
+      if ( batch_end - node > 1 )
+      {
+        ( *node )->update_batch( node, batch_end, clock_, from, to );
+      }
+      else if ( not( *node )->is_frozen() )
+      {
+        ( *node )->update( clock_, from, to );
+      }
+    }
+    catch ( std::exception& e )
+    {
+      // so throw the exception after parallel region
+      exceptions_raised.at( tid ) = lockPTR< WrappedThreadException >(
+        new WrappedThreadException( e ) );
+    }
+
+    node = batch_end;
+  }
+}
+
 bool
 nest::SimulationManager::wfr_update_( Node* n )
 {
@@ -919,28 +985,30 @@ nest::SimulationManager::update_()
       } // of if(wfr_is_used)
       // end of preliminary update
 
-      const std::vector< Node* >& thread_local_nodes =
-        kernel().node_manager.get_nodes_on_thread( tid );
-      for (
-        std::vector< Node* >::const_iterator node = thread_local_nodes.begin();
-        node != thread_local_nodes.end();
-        ++node )
+      // If requested, spikes generated during the first half of a
+      // complete slice are communicated while the nodes are updated
+      // for the second half. Secondary events are only communicated
+      // at the end of a slice, hence overlap is not used for them.
+      const bool overlap_spike_communication =
+        kernel().event_delivery_manager.get_overlap_spike_communication()
+        and to_step_ == kernel().connection_manager.get_min_delay()
+        and to_step_ - from_step_ > 1
+        and kernel().connection_manager.has_primary_connections()
+        and not kernel().connection_manager.secondary_connections_exist();
+
+      if ( overlap_spike_communication )
       {
-        // We update in a parallel region. Therefore, we need to catch
-        // exceptions here and then handle them after the parallel region.
-        try
-        {
-          if ( not( *node )->is_frozen() )
-          {
-            ( *node )->update( clock_, from_step_, to_step_ );
-          }
-        }
-        catch ( std::exception& e )
-        {
-          // so throw the exception after parallel region
-          exceptions_raised.at( tid ) = lockPTR< WrappedThreadException >(
-            new WrappedThreadException( e ) );
-        }
+        const delay split_step = from_step_ + ( to_step_ - from_step_ ) / 2;
+
+        update_nodes_( tid, from_step_, split_step, exceptions_raised );
+#pragma omp barrier
+        kernel().event_delivery_manager.start_gather_spike_data(
+          tid, split_step );
+        update_nodes_( tid, split_step, to_step_, exceptions_raised );
+      }
+      else
+      {
+        update_nodes_( tid, from_step_, to_step_, exceptions_raised );
       }
 
 // parallel section ends, wait until all threads are done -> synchronize
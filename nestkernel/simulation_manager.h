@@ -27,6 +27,7 @@
 #include <vector>
 
 // Includes from libnestutil:
+#include "lockptr.h"
 #include "manager_interface.h"
 
 // Includes from nestkernel:
@@ -35,6 +36,7 @@
 
 // Includes from sli:
 #include "dictdatum.h"
+#include "sliexceptions.h"
 
 namespace nest
 {
@@ -160,6 +162,11 @@ public:
 private:
   void call_update_(); //!< actually run simulation, aka wrap update_
   void update_();      //! actually perform simulation
+  //! update all nodes of thread tid from step from to step to
+  void update_nodes_( const thread tid,
+    const delay from,
+    const delay to,
+    std::vector< lockPTR< WrappedThreadException > >& exceptions_raised );
   bool wfr_update_( Node* );
   void advance_time_();   //!< Update time to next time step
   void print_progress_(); //!< TODO: Remove, replace by logging!
@@ -184,6 +191,7 @@ private:
                             //!< simulation must not be resumed
   bool print_time_;         //!< Indicates whether time should be printed during
                             //!< simulations (or not)
+  bool batch_update_;       //!< Update nodes of the same model in batches
   bool use_wfr_;            //!< Indicates wheter waveform relaxation is used
   double wfr_comm_interval_; //!< Desired waveform relaxation communication
                              //!< interval (in ms)
@@ -168,6 +168,15 @@ inline bool operator==( const Source& lhs, const Source& rhs )
   return ( lhs.gid_ == rhs.gid_ );
 }
 
+/**
+ * Sources are sorted by gid, see nest::sort().
+ */
+inline uint64_t
+radix_key( const Source& s )
+{
+  return s.get_gid();
+}
+
 } // namespace nest
 
 #endif // SOURCE_H
@@ -45,6 +45,8 @@ nest::SourceTable::initialize()
   assert( sizeof( Source ) == 8 );
   const thread num_threads = kernel().vp_manager.get_num_threads();
   sources_.resize( num_threads );
+  segment_starts_.resize( num_threads );
+  pending_disabled_lcids_.resize( num_threads );
   is_cleared_.resize( num_threads );
   saved_entry_point_.resize( num_threads );
   current_positions_.resize( num_threads );
@@ -54,6 +56,8 @@ nest::SourceTable::initialize()
   {
     const thread tid = kernel().vp_manager.get_thread_id();
     sources_[ tid ].resize( 0 );
+    segment_starts_[ tid ].resize( 0 );
+    pending_disabled_lcids_[ tid ].resize( 0 );
     resize_sources( tid );
     is_cleared_[ tid ] = false;
     saved_entry_point_[ tid ] = false;
@@ -72,6 +76,8 @@ nest::SourceTable::finalize()
     }
   }
   sources_.clear();
+  segment_starts_.clear();
+  pending_disabled_lcids_.clear();
   current_positions_.clear();
   saved_positions_.clear();
 }
@@ -162,6 +168,7 @@ nest::SourceTable::reserve( const thread tid,
   const synindex syn_id,
   const size_t count )
 {
+  sources_[ tid ][ syn_id ].reserve( sources_[ tid ][ syn_id ].size() + count );
 }
 
 nest::index
@@ -295,6 +302,10 @@ void
 nest::SourceTable::resize_sources( const thread tid )
 {
   sources_[ tid ].resize( kernel().model_manager.get_num_synapse_prototypes() );
+  segment_starts_[ tid ].resize(
+    kernel().model_manager.get_num_synapse_prototypes() );
+  pending_disabled_lcids_[ tid ].resize(
+    kernel().model_manager.get_num_synapse_prototypes() );
 }
 
 bool
@@ -72,6 +72,27 @@ private:
    */
   std::vector< bool > is_cleared_;
 
+  /**
+   * Positions at which the sorted segments of sources_ begin that were
+   * appended by incremental updates of the connection infrastructure.
+   * Entries in front of the first position are sorted as a whole. An
+   * empty vector means that sources_ is sorted as a whole.
+   *
+   * @see ConnectionManager::sort_new_connections()
+   */
+  std::vector< std::vector< std::vector< index > > > segment_starts_;
+
+  /**
+   * Positions of entries in sources_ whose connections have been
+   * disabled, but which still hold the gid of their source. Disabling
+   * an entry moves it to the end of its sorted segment, so entries in
+   * segments that are kept by incremental updates are only disabled
+   * when the connection infrastructure is rebuilt.
+   *
+   * @see SourceTable::disable_pending_sources()
+   */
+  std::vector< std::vector< std::vector< index > > > pending_disabled_lcids_;
+
   //! Needed during readout of sources_.
   std::vector< SourceTablePosition > current_positions_;
   //! Needed during readout of sources_.
@@ -109,8 +130,8 @@ public:
   void finalize();
 
   /**
-   * Reserve memory to avoid expensive reallocation of vectors during
-   * connection creation.
+   * Reserve memory for count further sources to avoid expensive
+   * reallocation of vectors during connection creation.
    */
   void reserve( const thread tid, const synindex syn_id, const size_t count );
 
@@ -122,6 +143,17 @@ public:
     const index gid,
     const bool is_primary );
 
+  /**
+   * Adds the sources gids[ i ] for begin <= i < end to sources_ in one
+   * step.
+   */
+  void add_sources( const thread tid,
+    const synindex syn_id,
+    const std::vector< index >& gids,
+    const size_t begin,
+    const size_t end,
+    const bool is_primary );
+
   /**
    * Clears sources_.
    */
@@ -207,20 +239,46 @@ public:
     std::map< index, size_t >& buffer_pos_of_source_gid_syn_id_ );
 
   /**
-   * Finds the first entry in sources_ at the given thread id and
-   * synapse type that is equal to sgid.
+   * Finds the first entry in each sorted segment of sources_ at the
+   * given thread id and synapse type that is equal to sgid and stores
+   * their positions in lcids.
    */
-  index find_first_source( const thread tid,
+  void find_first_sources( const thread tid,
     const synindex syn_id,
-    const index sgid ) const;
+    const index sgid,
+    std::vector< index >& lcids ) const;
 
   /**
-   * Marks entry in sources_ at given position as disabled.
+   * Starts a new sorted segment at the first entry of sources_ that
+   * was added after the connection infrastructure was last updated,
+   * i.e., the first of the unprocessed entries at the end of sources_,
+   * and returns its position.
+   */
+  index start_new_segment( const thread tid, const synindex syn_id );
+
+  /**
+   * Removes all segment boundaries after sources_ has been sorted as a
+   * whole.
+   */
+  void reset_segments( const thread tid );
+
+  /**
+   * Records that the entry in sources_ at given position is to be
+   * disabled. The entry keeps its gid until disable_pending_sources() is
+   * called, such that all segments of sources_ remain sorted.
    */
   void disable_connection( const thread tid,
     const synindex syn_id,
     const index lcid );
 
+  /**
+   * Marks the recorded entries in sources_ at positions from first on as
+   * disabled. Must be called before these entries are sorted.
+   */
+  void disable_pending_sources( const thread tid,
+    const synindex syn_id,
+    const index first );
+
   /**
    * Removes all entries from sources_ that are marked as disabled.
    */
@@ -267,6 +325,23 @@ SourceTable::add_source( const thread tid,
   sources_[ tid ][ syn_id ].push_back( src );
 }
 
+inline void
+SourceTable::add_sources( const thread tid,
+  const synindex syn_id,
+  const std::vector< index >& gids,
+  const size_t begin,
+  const size_t end,
+  const bool is_primary )
+{
+  std::vector< Source > srcs;
+  srcs.reserve( end - begin );
+  for ( size_t i = begin; i < end; ++i )
+  {
+    srcs.push_back( Source( gids[ i ], is_primary ) );
+  }
+  sources_[ tid ][ syn_id ].append( srcs.begin(), srcs.end() );
+}
+
 inline void
 SourceTable::clear( const thread tid )
 {
@@ -278,6 +353,8 @@ SourceTable::clear( const thread tid )
     it->clear();
   }
   sources_[ tid ].clear();
+  segment_starts_[ tid ].clear();
+  pending_disabled_lcids_[ tid ].clear();
   is_cleared_[ tid ] = true;
 }
 
@@ -388,33 +465,87 @@ SourceTable::no_targets_to_process( const thread tid )
   current_positions_[ tid ].lcid = -1;
 }
 
-inline index
-SourceTable::find_first_source( const thread tid,
+inline void
+SourceTable::find_first_sources( const thread tid,
   const synindex syn_id,
-  const index sgid ) const
+  const index sgid,
+  std::vector< index >& lcids ) const
 {
-  // binary search in sorted sources
-  const BlockVector< Source >::const_iterator begin =
-    sources_[ tid ][ syn_id ].begin();
-  const BlockVector< Source >::const_iterator end =
-    sources_[ tid ][ syn_id ].end();
-  BlockVector< Source >::const_iterator it =
-    std::lower_bound( begin, end, Source( sgid, true ) );
-
-  // source found by binary search could be disabled, iterate through
-  // sources until a valid one is found
-  while ( it != end )
+  lcids.clear();
+  const BlockVector< Source >& sources = sources_[ tid ][ syn_id ];
+  const std::vector< index >& segment_starts =
+    segment_starts_[ tid ][ syn_id ];
+
+  for ( size_t segment = 0; segment <= segment_starts.size(); ++segment )
   {
-    if ( it->get_gid() == sgid and not it->is_disabled() )
+    const index begin = segment == 0 ? 0 : segment_starts[ segment - 1 ];
+    const index end = segment < segment_starts.size()
+      ? segment_starts[ segment ]
+      : sources.size();
+
+    // binary search in sorted segment
+    const Source value( sgid, true );
+    index lo = begin;
+    index hi = end;
+    while ( lo < hi )
+    {
+      const index mid = lo + ( hi - lo ) / 2;
+      if ( sources[ mid ] < value )
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+
+    // source found by binary search could be disabled, iterate through
+    // the segment until a valid one is found
+    for ( index lcid = lo; lcid < end; ++lcid )
     {
-      const index lcid = it - begin;
-      return lcid;
+      if ( sources[ lcid ].get_gid() == sgid
+        and not sources[ lcid ].is_disabled() )
+      {
+        lcids.push_back( lcid );
+        break;
+      }
     }
-    ++it;
   }
+}
+
+inline index
+SourceTable::start_new_segment( const thread tid, const synindex syn_id )
+{
+  const BlockVector< Source >& sources = sources_[ tid ][ syn_id ];
+  std::vector< index >& segment_starts = segment_starts_[ tid ][ syn_id ];
+
+  // entries added since the last update have not been processed yet and
+  // are all located at the end
+  index first = sources.size();
+  while ( first > 0 and not sources[ first - 1 ].is_processed() )
+  {
+    --first;
+  }
+
+  if ( first > 0 and first < sources.size()
+    and ( segment_starts.empty() or segment_starts.back() < first ) )
+  {
+    segment_starts.push_back( first );
+  }
+  return first;
+}
 
-  // no enabled entry with this sgid found
-  return invalid_index;
+inline void
+SourceTable::reset_segments( const thread tid )
+{
+  for ( std::vector< std::vector< index > >::iterator it =
+          segment_starts_[ tid ].begin();
+        it != segment_starts_[ tid ].end();
+        ++it )
+  {
+    it->clear();
+  }
 }
 
 inline void
@@ -422,10 +553,33 @@ SourceTable::disable_connection( const thread tid,
   const synindex syn_id,
   const index lcid )
 {
-  // disabling a source changes its gid to 2^62 -1
-  // source here
   assert( not sources_[ tid ][ syn_id ][ lcid ].is_disabled() );
-  sources_[ tid ][ syn_id ][ lcid ].disable();
+  pending_disabled_lcids_[ tid ][ syn_id ].push_back( lcid );
+}
+
+inline void
+SourceTable::disable_pending_sources( const thread tid,
+  const synindex syn_id,
+  const index first )
+{
+  std::vector< index >& lcids = pending_disabled_lcids_[ tid ][ syn_id ];
+  std::vector< index >::iterator keep_end = lcids.begin();
+  for ( std::vector< index >::const_iterator it = lcids.begin();
+        it != lcids.end();
+        ++it )
+  {
+    if ( *it >= first )
+    {
+      // disabling a source changes its gid to 2^62 - 1
+      sources_[ tid ][ syn_id ][ *it ].disable();
+    }
+    else
+    {
+      *keep_end = *it;
+      ++keep_end;
+    }
+  }
+  lcids.erase( keep_end, lcids.end() );
 }
 
 inline void
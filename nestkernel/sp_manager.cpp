@@ -31,6 +31,8 @@
 
 // C++ includes:
 #include <algorithm>
+#include <cmath>
+#include <numeric>
 
 // Includes from nestkernel:
 #include "conn_builder.h"
@@ -38,6 +40,7 @@
 #include "connector_base.h"
 #include "connector_model.h"
 #include "kernel_manager.h"
+#include "mpi_manager_impl.h"
 #include "nest_names.h"
 
 namespace nest
@@ -429,6 +432,10 @@ SPManager::update_structural_plasticity()
  * structural plasticity is enabled. Retrieves the number of available
  * synaptic elements to create new synapses. Retrieves the number of
  * deleted synaptic elements to delete already created synapses.
+ *
+ * Vacant synaptic elements are not communicated. Only their number on
+ * each rank is exchanged, and the gids of the pre-synaptic partners of
+ * new synapses are sent to the ranks of the targets.
  * @param sp_builder The structural plasticity connection builder to use
  */
 void
@@ -444,23 +451,22 @@ SPManager::update_structural_plasticity( SPBuilder* sp_builder )
   std::vector< index > pre_deleted_id, post_deleted_id;
   std::vector< int > pre_deleted_n, post_deleted_n;
 
-  // Global vector for vacant and deleted synaptic element
-  std::vector< index > pre_vacant_id_global, post_vacant_id_global;
-  std::vector< int > pre_vacant_n_global, post_vacant_n_global;
-  std::vector< index > pre_deleted_id_global, post_deleted_id_global;
-  std::vector< int > pre_deleted_n_global, post_deleted_n_global;
+  // Global vector for deleted pre synaptic elements
+  std::vector< index > pre_deleted_id_global;
+  std::vector< int > pre_deleted_n_global;
 
   // Vector of displacements for communication
   std::vector< int > displacements;
 
-  // Get pre synaptic elements data from global nodes
+  // Get pre synaptic elements data from local nodes
   get_synaptic_elements( sp_builder->get_pre_synaptic_element_name(),
     pre_vacant_id,
     pre_vacant_n,
     pre_deleted_id,
     pre_deleted_n );
 
-  // Communicate the number of deleted pre-synaptic elements
+  // Communicate the number of deleted pre-synaptic elements, since the
+  // corresponding synapses are stored on the ranks of their targets
   kernel().mpi_manager.communicate(
     pre_deleted_id, pre_deleted_id_global, displacements );
   kernel().mpi_manager.communicate(
@@ -473,69 +479,49 @@ SPManager::update_structural_plasticity( SPBuilder* sp_builder )
       sp_builder->get_synapse_model(),
       sp_builder->get_pre_synaptic_element_name(),
       sp_builder->get_post_synaptic_element_name() );
-    // update the number of synaptic elements
-    get_synaptic_elements( sp_builder->get_pre_synaptic_element_name(),
-      pre_vacant_id,
-      pre_vacant_n,
-      pre_deleted_id,
-      pre_deleted_n );
-  }
-  // Get post synaptic elements data from local nodes
+  }
+
+  // Get post synaptic elements data from local nodes, synapses due to
+  // deleted post-synaptic elements are deleted locally
   get_synaptic_elements( sp_builder->get_post_synaptic_element_name(),
     post_vacant_id,
     post_vacant_n,
     post_deleted_id,
     post_deleted_n );
-  // Communicate the number of deleted post-synaptic elements
-  kernel().mpi_manager.communicate(
-    post_deleted_id, post_deleted_id_global, displacements );
-  kernel().mpi_manager.communicate(
-    post_deleted_n, post_deleted_n_global, displacements );
+  delete_synapses_from_post( post_deleted_id,
+    post_deleted_n,
+    sp_builder->get_synapse_model(),
+    sp_builder->get_pre_synaptic_element_name(),
+    sp_builder->get_post_synaptic_element_name() );
 
-  if ( post_deleted_id_global.size() > 0 )
-  {
-    delete_synapses_from_post( post_deleted_id_global,
-      post_deleted_n_global,
-      sp_builder->get_synapse_model(),
-      sp_builder->get_pre_synaptic_element_name(),
-      sp_builder->get_post_synaptic_element_name() );
-    get_synaptic_elements( sp_builder->get_pre_synaptic_element_name(),
-      pre_vacant_id,
-      pre_vacant_n,
-      pre_deleted_id,
-      pre_deleted_n );
-    get_synaptic_elements( sp_builder->get_post_synaptic_element_name(),
-      post_vacant_id,
-      post_vacant_n,
-      post_deleted_id,
-      post_deleted_n );
-  }
-
-  // Communicate vacant elements
-  kernel().mpi_manager.communicate(
-    pre_vacant_id, pre_vacant_id_global, displacements );
-  kernel().mpi_manager.communicate(
-    pre_vacant_n, pre_vacant_n_global, displacements );
-  kernel().mpi_manager.communicate(
-    post_vacant_id, post_vacant_id_global, displacements );
-  kernel().mpi_manager.communicate(
-    post_vacant_n, post_vacant_n_global, displacements );
+  // update the number of synaptic elements
+  get_synaptic_elements( sp_builder->get_pre_synaptic_element_name(),
+    pre_vacant_id,
+    pre_vacant_n,
+    pre_deleted_id,
+    pre_deleted_n );
+  get_synaptic_elements( sp_builder->get_post_synaptic_element_name(),
+    post_vacant_id,
+    post_vacant_n,
+    post_deleted_id,
+    post_deleted_n );
 
-  if ( pre_vacant_id_global.size() > 0 and post_vacant_id_global.size() > 0 )
-  {
-    create_synapses( pre_vacant_id_global,
-      pre_vacant_n_global,
-      post_vacant_id_global,
-      post_vacant_n_global,
-      sp_builder );
-  }
+  create_synapses(
+    pre_vacant_id, pre_vacant_n, post_vacant_id, post_vacant_n, sp_builder );
 }
 
 /**
- * Dynamic creation of synapses
- * @param pre_id source id
+ * Dynamic creation of synapses between the vacant synaptic elements of
+ * all ranks. All ranks draw the same matrix of the numbers of new
+ * synapses between pre synaptic elements on each rank and post synaptic
+ * elements on each rank, which yields the same distribution as a random
+ * pairing of all vacant elements. The cost of the draws depends only on
+ * the number of ranks. Each rank then chooses its pre and post synaptic
+ * elements locally, and the pre synaptic gids are sent to the ranks of
+ * their targets.
+ * @param pre_id source id, local nodes only
  * @param pre_n number of available synaptic elements in the pre node
- * @param post_id target id
+ * @param post_id target id, local nodes only
  * @param post_n number of available synaptic elements in the post node
  * @param sp_conn_builder structural plasticity connection builder to use
  */
@@ -546,32 +532,87 @@ SPManager::create_synapses( std::vector< index >& pre_id,
   std::vector< int >& post_n,
   SPBuilder* sp_conn_builder )
 {
+  const thread rank = kernel().mpi_manager.get_rank();
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+
   std::vector< index > pre_id_rnd;
   std::vector< index > post_id_rnd;
-  std::vector< index >::iterator pre_it, post_it;
-
-  // shuffle the vacant element
   serialize_id( pre_id, pre_n, pre_id_rnd );
   serialize_id( post_id, post_n, post_id_rnd );
 
-  // Shuffle only the largest vector
-  if ( pre_id_rnd.size() > post_id_rnd.size() )
+  // Communicate the number of vacant elements on each rank
+  std::vector< long > pre_count( num_processes, 0 );
+  std::vector< long > post_count( num_processes, 0 );
+  pre_count[ rank ] = pre_id_rnd.size();
+  post_count[ rank ] = post_id_rnd.size();
+  kernel().mpi_manager.communicate( pre_count );
+  kernel().mpi_manager.communicate( post_count );
+
+  const size_t num_synapses =
+    std::min( std::accumulate( pre_count.begin(), pre_count.end(), 0L ),
+      std::accumulate( post_count.begin(), post_count.end(), 0L ) );
+  if ( num_synapses == 0 )
   {
-    // we only shuffle the n first items,
-    // where n is the number of post synaptic elements
-    global_shuffle( pre_id_rnd, post_id_rnd.size() );
-    pre_id_rnd.resize( post_id_rnd.size() );
+    return;
   }
-  else
+
+  // Draw the number of pre and post synaptic elements used on each rank
+  std::vector< long > pre_drawn;
+  std::vector< long > post_drawn;
+  global_draw_counts( pre_count, num_synapses, pre_drawn );
+  global_draw_counts( post_count, num_synapses, post_drawn );
+  const size_t num_post = post_drawn[ rank ];
+
+  // Draw the number of synapses between the pre synaptic elements on each
+  // rank and the post synaptic elements on each rank row by row. All rows
+  // are drawn on all ranks to keep the global random number generator in
+  // sync, but only the row of this rank is kept.
+  std::vector< long > send_count;
+  std::vector< long > row;
+  for ( size_t r = 0; r < num_processes; ++r )
   {
-    // we only shuffle the n first items,
-    // where n is the number of pre synaptic elements
-    global_shuffle( post_id_rnd, pre_id_rnd.size() );
-    post_id_rnd.resize( pre_id_rnd.size() );
+    global_draw_counts( post_drawn, pre_drawn[ r ], row );
+    for ( size_t q = 0; q < num_processes; ++q )
+    {
+      post_drawn[ q ] -= row[ q ];
+    }
+    if ( r == static_cast< size_t >( rank ) )
+    {
+      send_count.swap( row );
+    }
+  }
+
+  // Choose the local pre synaptic elements and send them to the ranks of
+  // their targets. Elements sent to other ranks are connected here,
+  // since their synapses will always be created.
+  local_shuffle( pre_id_rnd, pre_drawn[ rank ] );
+  std::vector< std::vector< index > > send_gids( num_processes );
+  std::vector< index >::const_iterator pre_it = pre_id_rnd.begin();
+  for ( size_t r = 0; r < num_processes; ++r )
+  {
+    send_gids[ r ].assign( pre_it, pre_it + send_count[ r ] );
+    pre_it += send_count[ r ];
+
+    if ( r != static_cast< size_t >( rank ) )
+    {
+      for ( size_t i = 0; i < send_gids[ r ].size(); ++i )
+      {
+        kernel()
+          .node_manager.get_node( send_gids[ r ][ i ] )
+          ->connect_synaptic_element(
+            sp_conn_builder->get_pre_synaptic_element_name(), 1 );
+      }
+    }
   }
 
-  // create synapse
-  GIDCollection sources = GIDCollection( pre_id_rnd );
+  std::vector< index > recv_gids;
+  communicate_gids( send_gids, recv_gids );
+  assert( recv_gids.size() == num_post );
+
+  // Choose the local post synaptic elements and create synapses
+  local_shuffle( post_id_rnd, num_post );
+
+  GIDCollection sources = GIDCollection( recv_gids );
   GIDCollection targets = GIDCollection( post_id_rnd );
 
   sp_conn_builder->sp_connect( sources, targets );
@@ -580,7 +621,11 @@ SPManager::create_synapses( std::vector< index >& pre_id,
 /**
  * Deletion of synapses due to the loss of a pre synaptic element. The
  * corresponding pre synaptic element will still remain available for a new
- * connection on the following updates in connectivity
+ * connection on the following updates in connectivity.
+ *
+ * Only the number of targets of each source on each rank is
+ * communicated. All ranks draw the same number of synapses to delete on
+ * each rank, which are then chosen locally.
  * @param pre_deleted_id Id of the node with the deleted pre synaptic element
  * @param pre_deleted_n number of deleted pre synaptic elements
  * @param synapse_model model name
@@ -594,88 +639,57 @@ SPManager::delete_synapses_from_pre( const std::vector< index >& pre_deleted_id,
   const std::string& se_pre_name,
   const std::string& se_post_name )
 {
-  /*
-   * Synapses deletion due to the loss of a pre-synaptic element need a
-   * communication of the lists of target
-   */
+  const thread tid = kernel().vp_manager.get_thread_id();
+  const thread rank = kernel().mpi_manager.get_rank();
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+  const size_t num_deleted = pre_deleted_id.size();
 
-  // Connectivity
+  // Connectivity, local targets only
   std::vector< std::vector< index > > connectivity;
-  std::vector< index > global_targets;
-  std::vector< int > displacements;
-
-  // iterators
-  std::vector< std::vector< index > >::iterator connectivity_it;
-  std::vector< index >::const_iterator id_it;
-  std::vector< int >::iterator n_it;
-
   kernel().connection_manager.get_targets(
     pre_deleted_id, synapse_model, se_post_name, connectivity );
 
-  id_it = pre_deleted_id.begin();
-  n_it = pre_deleted_n.begin();
-  connectivity_it = connectivity.begin();
-  for ( ; id_it != pre_deleted_id.end() and n_it != pre_deleted_n.end();
-        id_it++, n_it++, connectivity_it++ )
-  {
-    // Communicate the list of targets
-    kernel().mpi_manager.communicate(
-      *connectivity_it, global_targets, displacements );
-    // shuffle only the first n items, n is the number of deleted synaptic
-    // elements
-    if ( -( *n_it ) > static_cast< int >( global_targets.size() ) )
-    {
-      *n_it = -global_targets.size();
-    }
-    global_shuffle( global_targets, -( *n_it ) );
-
-    for ( int i = 0; i < -( *n_it ); ++i ) // n is negative
-    {
-      delete_synapse(
-        *id_it, global_targets[ i ], synapse_model, se_pre_name, se_post_name );
-    }
+  // Communicate the number of targets of each source on each rank
+  std::vector< int > local_count( num_deleted );
+  std::vector< int > global_count;
+  std::vector< int > displacements;
+  for ( size_t i = 0; i < num_deleted; ++i )
+  {
+    local_count[ i ] = connectivity[ i ].size();
   }
-}
+  kernel().mpi_manager.communicate( local_count, global_count, displacements );
 
-/**
- * Handles the deletion of synapses between source and target nodes. The
- * deletion is defined by the pre and post synaptic elements and the synapse
- * type. Updates the number of connected synaptic elements in the source and
- * target.
- * @param sgid source id
- * @param tgid target id
- * @param syn_id synapse type
- * @param se_pre_name name of the pre synaptic element
- * @param se_post_name name of the post synaptic element
- */
-void
-SPManager::delete_synapse( const index sgid,
-  const index tgid,
-  const long syn_id,
-  const std::string se_pre_name,
-  const std::string se_post_name )
-{
-  // get thread id
-  const int tid = kernel().vp_manager.get_thread_id();
-  if ( kernel().node_manager.is_local_gid( sgid ) )
+  std::vector< long > target_count( num_processes );
+  std::vector< long > drawn;
+  for ( size_t i = 0; i < num_deleted; ++i )
   {
-    Node* const source = kernel().node_manager.get_node( sgid );
-    const thread source_thread = source->get_thread();
-    if ( tid == source_thread )
+    for ( size_t r = 0; r < num_processes; ++r )
     {
-      source->connect_synaptic_element( se_pre_name, -1 );
+      target_count[ r ] = global_count[ displacements[ r ] + i ];
     }
-  }
 
-  if ( kernel().node_manager.is_local_gid( tgid ) )
-  {
-    Node* const target = kernel().node_manager.get_node( tgid );
-    const thread target_thread = target->get_thread();
-    if ( tid == target_thread )
+    // delete at most all existing synapses, n is negative
+    const size_t n = std::min(
+      static_cast< long >( -pre_deleted_n[ i ] ),
+      std::accumulate( target_count.begin(), target_count.end(), 0L ) );
+    global_draw_counts( target_count, n, drawn );
+    const size_t n_local = drawn[ rank ];
+
+    local_shuffle( connectivity[ i ], n_local );
+    for ( size_t j = 0; j < n_local; ++j )
     {
-      kernel().connection_manager.disconnect( tid, syn_id, sgid, tgid );
+      const index tgid = connectivity[ i ][ j ];
+      kernel().connection_manager.disconnect(
+        tid, synapse_model, pre_deleted_id[ i ], tgid );
+      kernel().node_manager.get_node( tgid )->connect_synaptic_element(
+        se_post_name, -1 );
+    }
 
-      target->connect_synaptic_element( se_post_name, -1 );
+    if ( kernel().node_manager.is_local_gid( pre_deleted_id[ i ] ) )
+    {
+      kernel()
+        .node_manager.get_node( pre_deleted_id[ i ] )
+        ->connect_synaptic_element( se_pre_name, -static_cast< int >( n ) );
     }
   }
 }
@@ -683,7 +697,11 @@ SPManager::delete_synapse( const index sgid,
 /**
  * Deletion of synapses due to the loss of a post synaptic element. The
  * corresponding pre synaptic element will still remain available for a new
- * connection on the following updates in connectivity
+ * connection on the following updates in connectivity.
+ *
+ * Since synapses are stored on the rank of their target, they are chosen
+ * and deleted locally. Only the gids of the sources of deleted synapses
+ * are sent to the ranks of the sources.
  * @param post_deleted_id Id of the node with the deleted post synaptic element
  * @param post_deleted_n number of deleted post synaptic elements
  * @param synapse_model model name
@@ -697,50 +715,43 @@ SPManager::delete_synapses_from_post( std::vector< index >& post_deleted_id,
   std::string se_pre_name,
   std::string se_post_name )
 {
-  /*
-   * TODO: Synapses deletion due to the loss of a post-synaptic element can
-   * be done locally (except for the update of the number of pre-synaptic
-   * element)
-   */
-
-  // Connectivity
-  std::vector< std::vector< index > > connectivity;
-  std::vector< index > global_sources;
-  std::vector< int > displacements;
-
-  // iterators
-  std::vector< std::vector< index > >::iterator connectivity_it;
-  std::vector< index >::iterator id_it;
-  std::vector< int >::iterator n_it;
+  const thread tid = kernel().vp_manager.get_thread_id();
 
   // Retrieve the connected sources
+  std::vector< std::vector< index > > connectivity;
   kernel().connection_manager.get_sources(
     post_deleted_id, synapse_model, connectivity );
 
-  id_it = post_deleted_id.begin();
-  n_it = post_deleted_n.begin();
-  connectivity_it = connectivity.begin();
-
-  for ( ; id_it != post_deleted_id.end() and n_it != post_deleted_n.end();
-        id_it++, n_it++, connectivity_it++ )
+  std::vector< std::vector< index > > send_gids(
+    kernel().mpi_manager.get_num_processes() );
+  for ( size_t i = 0; i < post_deleted_id.size(); ++i )
   {
-    // Communicate the list of sources
-    kernel().mpi_manager.communicate(
-      *connectivity_it, global_sources, displacements );
-    // shuffle only the first n items, n is the number of deleted synaptic
-    // elements
-    if ( -( *n_it ) > static_cast< int >( global_sources.size() ) )
-    {
-      *n_it = -global_sources.size();
-    }
-    global_shuffle( global_sources, -( *n_it ) );
+    // delete at most all existing synapses, n is negative
+    const size_t n = std::min(
+      static_cast< size_t >( -post_deleted_n[ i ] ), connectivity[ i ].size() );
+    local_shuffle( connectivity[ i ], n );
 
-    for ( int i = 0; i < -( *n_it ); i++ ) // n is negative
+    Node* const target = kernel().node_manager.get_node( post_deleted_id[ i ] );
+    for ( size_t j = 0; j < n; ++j )
     {
-      delete_synapse(
-        global_sources[ i ], *id_it, synapse_model, se_pre_name, se_post_name );
+      const index sgid = connectivity[ i ][ j ];
+      kernel().connection_manager.disconnect(
+        tid, synapse_model, sgid, post_deleted_id[ i ] );
+      target->connect_synaptic_element( se_post_name, -1 );
+      send_gids[ kernel().mpi_manager.get_process_id_of_gid( sgid ) ]
+        .push_back( sgid );
     }
   }
+
+  std::vector< index > recv_gids;
+  communicate_gids( send_gids, recv_gids );
+  for ( std::vector< index >::const_iterator sgid = recv_gids.begin();
+        sgid != recv_gids.end();
+        ++sgid )
+  {
+    kernel().node_manager.get_node( *sgid )->connect_synaptic_element(
+      se_pre_name, -1 );
+  }
 }
 
 void
@@ -836,25 +847,228 @@ nest::SPManager::global_shuffle( std::vector< index >& v )
  */
 void
 nest::SPManager::global_shuffle( std::vector< index >& v, size_t n )
+{
+  // shuffle using the global random number generator
+  shuffle_( v, n, kernel().rng_manager.get_grng() );
+}
+
+/*
+ * Shuffles the n first items of the vector v, using the random number
+ * generator of the calling thread
+ */
+void
+nest::SPManager::local_shuffle( std::vector< index >& v, size_t n )
+{
+  shuffle_(
+    v, n, kernel().rng_manager.get_rng( kernel().vp_manager.get_thread_id() ) );
+}
+
+/*
+ * Partial Fisher-Yates shuffle: afterwards, v contains n items drawn
+ * without replacement from v, in random order
+ */
+void
+nest::SPManager::shuffle_( std::vector< index >& v,
+  size_t n,
+  librandom::RngPtr rng )
 {
   assert( n <= v.size() );
 
-  // shuffle res using the global random number generator
-  unsigned int N = v.size();
-  std::vector< index > v2;
-  index tmp;
-  unsigned int rnd;
-  std::vector< index >::iterator rndi;
-  for ( unsigned int i = 0; i < n; i++ )
-  {
-    N = v.size();
-    rnd = kernel().rng_manager.get_grng()->ulrand( N );
-    tmp = v[ rnd ];
-    v2.push_back( tmp );
-    rndi = v.begin();
-    v.erase( rndi + rnd );
-  }
-  v = v2;
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const size_t j = i + rng->ulrand( v.size() - i );
+    std::swap( v[ i ], v[ j ] );
+  }
+  v.resize( n );
+}
+
+/*
+ * Draws num_draws items without replacement from a pool, in which
+ * count[ r ] items belong to rank r, and stores the number of drawn items
+ * of each rank, i.e., draws from the multivariate hypergeometric
+ * distribution. The counts are drawn one rank after the other from
+ * univariate hypergeometric distributions, using the global random number
+ * generator, so that all ranks obtain the same result. The cost depends
+ * only on the number of ranks, not on the number of items.
+ */
+void
+nest::SPManager::global_draw_counts( const std::vector< long >& count,
+  const size_t num_draws,
+  std::vector< long >& drawn )
+{
+  librandom::RngPtr grng = kernel().rng_manager.get_grng();
+
+  long total = std::accumulate( count.begin(), count.end(), 0L );
+  assert( num_draws <= static_cast< size_t >( total ) );
+
+  drawn.assign( count.size(), 0 );
+  long remaining_draws = num_draws;
+  for ( size_t r = 0; r < count.size() and remaining_draws > 0; ++r )
+  {
+    total -= count[ r ];
+    drawn[ r ] = hypergeometric_( count[ r ], total, remaining_draws, grng );
+    remaining_draws -= drawn[ r ];
+  }
+}
+
+/*
+ * Draws the number of good items among sample items drawn without
+ * replacement from good good and bad bad items. Small samples are drawn
+ * by inversion, large samples by the ratio-of-uniforms rejection method
+ * H2PE/HRUA of Stadlober (1989), whose cost does not depend on the
+ * population size.
+ */
+long
+nest::SPManager::hypergeometric_( const long good,
+  const long bad,
+  const long sample,
+  librandom::RngPtr rng )
+{
+  const long popsize = good + bad;
+  assert( 0 <= sample and sample <= popsize );
+
+  if ( sample == 0 or good == 0 )
+  {
+    return 0;
+  }
+  if ( bad == 0 )
+  {
+    return sample;
+  }
+  if ( sample == popsize )
+  {
+    return good;
+  }
+
+  const long min_good_bad = std::min( good, bad );
+  const long max_good_bad = std::max( good, bad );
+  // draw the smaller of sample and its complement
+  const long m = std::min( sample, popsize - sample );
+  long z;
+
+  if ( m <= 10 )
+  {
+    // inversion, counting the items of the smaller group drawn
+    double y = min_good_bad;
+    const long d1 = popsize - m;
+    long k = m;
+    while ( y > 0.0 and k > 0 )
+    {
+      y -= std::floor( rng->drand() + y / ( d1 + k ) );
+      --k;
+    }
+    z = min_good_bad - static_cast< long >( y );
+  }
+  else
+  {
+    const double d4 = static_cast< double >( min_good_bad ) / popsize;
+    const double d5 = 1.0 - d4;
+    const double d6 = m * d4 + 0.5;
+    const double d7 = std::sqrt(
+      static_cast< double >( popsize - m ) * m * d4 * d5 / ( popsize - 1 )
+      + 0.5 );
+    const double d8 = 1.7155277699214135 * d7 + 0.8989161620588988;
+    const long d9 = static_cast< long >(
+      std::floor( static_cast< double >( m + 1 ) * ( min_good_bad + 1 )
+        / ( popsize + 2 ) ) );
+    const double d10 = std::lgamma( d9 + 1.0 )
+      + std::lgamma( min_good_bad - d9 + 1.0 ) + std::lgamma( m - d9 + 1.0 )
+      + std::lgamma( max_good_bad - m + d9 + 1.0 );
+    // 16 for 16-decimal-digit precision of the constants in d8
+    const double d11 =
+      std::min( std::min( m, min_good_bad ) + 1.0, std::floor( d6 + 16 * d7 ) );
+
+    while ( true )
+    {
+      const double x = rng->drand();
+      const double y = rng->drand();
+      const double w = d6 + d8 * ( y - 0.5 ) / x;
+
+      // fast rejection
+      if ( w < 0.0 or w >= d11 )
+      {
+        continue;
+      }
+
+      z = static_cast< long >( std::floor( w ) );
+      const double t = d10
+        - ( std::lgamma( z + 1.0 ) + std::lgamma( min_good_bad - z + 1.0 )
+            + std::lgamma( m - z + 1.0 )
+            + std::lgamma( max_good_bad - m + z + 1.0 ) );
+
+      // fast acceptance
+      if ( x * ( 4.0 - x ) - 3.0 <= t )
+      {
+        break;
+      }
+      // fast rejection
+      if ( x * ( x - t ) >= 1.0 )
+      {
+        continue;
+      }
+      if ( 2.0 * std::log( x ) <= t )
+      {
+        break;
+      }
+    }
+  }
+
+  // z counts the items of the smaller group among the smaller of sample
+  // and its complement
+  if ( good > bad )
+  {
+    z = m - z;
+  }
+  if ( m < sample )
+  {
+    z = good - z;
+  }
+  return z;
+}
+
+/*
+ * Sends the gids in send_gids[ r ] to rank r, using a single Alltoall.
+ * Each chunk starts with the number of gids it contains.
+ */
+void
+nest::SPManager::communicate_gids(
+  const std::vector< std::vector< index > >& send_gids,
+  std::vector< index >& recv_gids )
+{
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+
+  std::vector< long > max_count( 1, 0 );
+  for ( size_t r = 0; r < num_processes; ++r )
+  {
+    max_count[ 0 ] =
+      std::max( max_count[ 0 ], static_cast< long >( send_gids[ r ].size() ) );
+  }
+  kernel().mpi_manager.communicate_Allreduce_max_in_place( max_count );
+
+  const size_t chunk_size = max_count[ 0 ] + 1;
+  std::vector< index > send_buffer( num_processes * chunk_size, 0 );
+  std::vector< index > recv_buffer( num_processes * chunk_size, 0 );
+  for ( size_t r = 0; r < num_processes; ++r )
+  {
+    send_buffer[ r * chunk_size ] = send_gids[ r ].size();
+    std::copy( send_gids[ r ].begin(),
+      send_gids[ r ].end(),
+      send_buffer.begin() + r * chunk_size + 1 );
+  }
+
+  // the send/recv count is given in units of unsigned int
+  kernel().mpi_manager.communicate_Alltoall( send_buffer,
+    recv_buffer,
+    chunk_size * sizeof( index ) / sizeof( unsigned int ) );
+
+  recv_gids.clear();
+  for ( size_t r = 0; r < num_processes; ++r )
+  {
+    const std::vector< index >::const_iterator begin =
+      recv_buffer.begin() + r * chunk_size + 1;
+    recv_gids.insert(
+      recv_gids.end(), begin, begin + recv_buffer[ r * chunk_size ] );
+  }
 }
 
 
@@ -36,6 +36,9 @@
 // Includes from libnestutil:
 #include "manager_interface.h"
 
+// Includes from librandom:
+#include "randomgen.h"
+
 // Includes from nestkernel:
 #include "gid_collection.h"
 #include "growth_curve_factory.h"
@@ -187,13 +190,6 @@ public:
     index synapse_model,
     std::string se_pre_name,
     std::string se_post_name );
-  // Deletion of synapses
-  void delete_synapse( index source,
-    index target,
-    long syn_id,
-    std::string se_pre_name,
-    std::string se_post_name );
-
   void get_synaptic_elements( std::string se_name,
     std::vector< index >& se_vacant_id,
     std::vector< int >& se_vacant_n,
@@ -205,8 +201,24 @@ public:
     std::vector< index >& res );
   void global_shuffle( std::vector< index >& v );
   void global_shuffle( std::vector< index >& v, size_t n );
+  void local_shuffle( std::vector< index >& v, size_t n );
+
+  // Numbers of items per rank drawn from a pool distributed over all ranks
+  void global_draw_counts( const std::vector< long >& count,
+    const size_t num_draws,
+    std::vector< long >& drawn );
+  // Send gids to other ranks
+  void communicate_gids( const std::vector< std::vector< index > >& send_gids,
+    std::vector< index >& recv_gids );
 
 private:
+  static void
+  shuffle_( std::vector< index >& v, size_t n, librandom::RngPtr rng );
+  static long hypergeometric_( const long good,
+    const long bad,
+    const long sample,
+    librandom::RngPtr rng );
+
   /**
    * Time interval for structural plasticity update (creation/deletion of
    * synapses).
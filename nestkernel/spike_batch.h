@@ -0,0 +1,136 @@
+/*
+ *  spike_batch.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_BATCH_H
+#define SPIKE_BATCH_H
+
+// C++ includes:
+#include <cstddef>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Received spikes of a single synapse type that are delivered by one
+ * thread with a single call to ConnectorBase::send_batch().
+ *
+ * Each spike is identified by the lcid of the first connection of its
+ * source, the lag within the current min-delay interval, the offset of
+ * the spike time for off-grid spiking, and the gid of its source. The
+ * entries are stored column-wise, such that the connector only touches
+ * the data it needs while walking the batch.
+ *
+ * @see SpikeData, EventDeliveryManager::deliver_events_
+ */
+class SpikeBatch
+{
+public:
+  SpikeBatch();
+
+  //! Remove all spikes, keeping the allocated memory
+  void clear();
+
+  void push_back( const index lcid,
+    const unsigned int lag,
+    const double offset,
+    const index source_gid );
+
+  size_t size() const;
+
+  index get_lcid( const size_t i ) const;
+  unsigned int get_lag( const size_t i ) const;
+  double get_offset( const size_t i ) const;
+  index get_source_gid( const size_t i ) const;
+
+private:
+  std::vector< index > lcids_;
+  std::vector< unsigned int > lags_;
+  std::vector< double > offsets_;
+  std::vector< index > source_gids_;
+};
+
+inline SpikeBatch::SpikeBatch()
+  : lcids_()
+  , lags_()
+  , offsets_()
+  , source_gids_()
+{
+}
+
+inline void
+SpikeBatch::clear()
+{
+  lcids_.clear();
+  lags_.clear();
+  offsets_.clear();
+  source_gids_.clear();
+}
+
+inline void
+SpikeBatch::push_back( const index lcid,
+  const unsigned int lag,
+  const double offset,
+  const index source_gid )
+{
+  lcids_.push_back( lcid );
+  lags_.push_back( lag );
+  offsets_.push_back( offset );
+  source_gids_.push_back( source_gid );
+}
+
+inline size_t
+SpikeBatch::size() const
+{
+  return lcids_.size();
+}
+
+inline index
+SpikeBatch::get_lcid( const size_t i ) const
+{
+  return lcids_[ i ];
+}
+
+inline unsigned int
+SpikeBatch::get_lag( const size_t i ) const
+{
+  return lags_[ i ];
+}
+
+inline double
+SpikeBatch::get_offset( const size_t i ) const
+{
+  return offsets_[ i ];
+}
+
+inline index
+SpikeBatch::get_source_gid( const size_t i ) const
+{
+  return source_gids_[ i ];
+}
+
+} // namespace nest
+
+#endif /* SPIKE_BATCH_H */
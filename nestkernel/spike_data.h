@@ -126,6 +126,20 @@ public:
    * Returns offset.
    */
   double get_offset() const;
+
+  /**
+   * Returns thread index, synapse-type index and lag packed into 32
+   * bits. Spikes with identical keys form runs in the compressed MPI
+   * buffer format.
+   */
+  unsigned int get_run_key() const;
+
+  /**
+   * Sets thread index, synapse-type index and lag from a key obtained
+   * by get_run_key(), and the local connection ID. Resets the status
+   * flag.
+   */
+  void set_from_run_key( const unsigned int key, const index lcid );
 };
 
 inline SpikeData::SpikeData()
@@ -249,6 +263,23 @@ SpikeData::get_offset() const
   return 0;
 }
 
+inline unsigned int
+SpikeData::get_run_key() const
+{
+  return ( static_cast< unsigned int >( tid_ ) << 22 )
+    | ( static_cast< unsigned int >( syn_id_ ) << 14 ) | lag_;
+}
+
+inline void
+SpikeData::set_from_run_key( const unsigned int key, const index lcid )
+{
+  lcid_ = lcid;
+  marker_ = default_marker_;
+  lag_ = key & 0x3FFF;
+  tid_ = key >> 22;
+  syn_id_ = ( key >> 14 ) & 0xFF;
+}
+
 class OffGridSpikeData : public SpikeData
 {
 private:
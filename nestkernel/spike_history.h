@@ -0,0 +1,370 @@
+/*
+ *  spike_history.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_HISTORY_H
+#define SPIKE_HISTORY_H
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+// Includes from nestkernel:
+#include "histentry.h"
+
+namespace nest
+{
+
+/**
+ * Spike history of a node in a contiguous circular buffer.
+ *
+ * Entries are appended at the end in order of increasing spike time and
+ * removed from the front once they have been read by all incoming STDP
+ * connections, so the buffer behaves like the std::deque it replaces, but
+ * it allocates only when the number of entries exceeds its capacity, which
+ * is then doubled. Since entries are sorted by time, the range of entries
+ * in a time interval can be found by binary search, using the random access
+ * iterators of the buffer.
+ *
+ * As for std::deque, iterators are invalidated by push_back() and
+ * pop_front().
+ */
+class SpikeHistory
+{
+public:
+  class iterator
+  {
+    friend class SpikeHistory;
+
+  public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef histentry value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef histentry* pointer;
+    typedef histentry& reference;
+
+    iterator();
+
+    histentry& operator*() const;
+    histentry* operator->() const;
+    histentry& operator[]( const difference_type n ) const;
+
+    iterator& operator++();
+    iterator operator++( int );
+    iterator& operator--();
+    iterator operator--( int );
+    iterator& operator+=( const difference_type n );
+    iterator& operator-=( const difference_type n );
+    iterator operator+( const difference_type n ) const;
+    iterator operator-( const difference_type n ) const;
+    difference_type operator-( const iterator& other ) const;
+
+    bool operator==( const iterator& other ) const;
+    bool operator!=( const iterator& other ) const;
+    bool operator<( const iterator& other ) const;
+    bool operator>( const iterator& other ) const;
+    bool operator<=( const iterator& other ) const;
+    bool operator>=( const iterator& other ) const;
+
+  private:
+    iterator( SpikeHistory* history, const size_t pos );
+
+    SpikeHistory* history_;
+    size_t pos_; //!< position relative to the front of the history
+  };
+
+  SpikeHistory();
+
+  size_t size() const;
+  bool empty() const;
+
+  //! Return number of entries that can be stored without allocation
+  size_t capacity() const;
+
+  histentry& operator[]( const size_t i );
+  const histentry& operator[]( const size_t i ) const;
+  histentry& front();
+  histentry& back();
+
+  iterator begin();
+  iterator end();
+
+  //! Return iterator to the first entry with t_ >= t, or end() if none
+  iterator lower_bound( const double t );
+
+  void push_back( const histentry& entry );
+  void pop_front();
+
+  //! Remove all entries, keeping the allocated storage
+  void clear();
+
+private:
+  //! Move entries into storage of twice the capacity
+  void grow_();
+
+  static bool is_before_( const histentry& entry, const double t );
+
+  //! Initial capacity, must be a power of two
+  static const size_t min_capacity_ = 16;
+
+  //! Storage, size is zero or a power of two
+  std::vector< histentry > buffer_;
+  size_t head_; //!< index of the front entry in buffer_
+  size_t size_; //!< number of entries
+};
+
+inline SpikeHistory::iterator::iterator()
+  : history_( 0 )
+  , pos_( 0 )
+{
+}
+
+inline SpikeHistory::iterator::iterator( SpikeHistory* history,
+  const size_t pos )
+  : history_( history )
+  , pos_( pos )
+{
+}
+
+inline histentry& SpikeHistory::iterator::operator*() const
+{
+  return ( *history_ )[ pos_ ];
+}
+
+inline histentry* SpikeHistory::iterator::operator->() const
+{
+  return &( *history_ )[ pos_ ];
+}
+
+inline histentry& SpikeHistory::iterator::operator[](
+  const difference_type n ) const
+{
+  return ( *history_ )[ pos_ + n ];
+}
+
+inline SpikeHistory::iterator& SpikeHistory::iterator::operator++()
+{
+  ++pos_;
+  return *this;
+}
+
+inline SpikeHistory::iterator SpikeHistory::iterator::operator++( int )
+{
+  iterator tmp = *this;
+  ++pos_;
+  return tmp;
+}
+
+inline SpikeHistory::iterator& SpikeHistory::iterator::operator--()
+{
+  --pos_;
+  return *this;
+}
+
+inline SpikeHistory::iterator SpikeHistory::iterator::operator--( int )
+{
+  iterator tmp = *this;
+  --pos_;
+  return tmp;
+}
+
+inline SpikeHistory::iterator& SpikeHistory::iterator::operator+=(
+  const difference_type n )
+{
+  pos_ += n;
+  return *this;
+}
+
+inline SpikeHistory::iterator& SpikeHistory::iterator::operator-=(
+  const difference_type n )
+{
+  pos_ -= n;
+  return *this;
+}
+
+inline SpikeHistory::iterator SpikeHistory::iterator::operator+(
+  const difference_type n ) const
+{
+  return iterator( history_, pos_ + n );
+}
+
+inline SpikeHistory::iterator SpikeHistory::iterator::operator-(
+  const difference_type n ) const
+{
+  return iterator( history_, pos_ - n );
+}
+
+inline SpikeHistory::iterator::difference_type SpikeHistory::iterator::
+operator-( const iterator& other ) const
+{
+  return static_cast< difference_type >( pos_ )
+    - static_cast< difference_type >( other.pos_ );
+}
+
+inline bool SpikeHistory::iterator::operator==( const iterator& other ) const
+{
+  return pos_ == other.pos_;
+}
+
+inline bool SpikeHistory::iterator::operator!=( const iterator& other ) const
+{
+  return pos_ != other.pos_;
+}
+
+inline bool SpikeHistory::iterator::operator<( const iterator& other ) const
+{
+  return pos_ < other.pos_;
+}
+
+inline bool SpikeHistory::iterator::operator>( const iterator& other ) const
+{
+  return pos_ > other.pos_;
+}
+
+inline bool SpikeHistory::iterator::operator<=( const iterator& other ) const
+{
+  return pos_ <= other.pos_;
+}
+
+inline bool SpikeHistory::iterator::operator>=( const iterator& other ) const
+{
+  return pos_ >= other.pos_;
+}
+
+inline SpikeHistory::SpikeHistory()
+  : buffer_()
+  , head_( 0 )
+  , size_( 0 )
+{
+}
+
+inline size_t
+SpikeHistory::size() const
+{
+  return size_;
+}
+
+inline bool
+SpikeHistory::empty() const
+{
+  return size_ == 0;
+}
+
+inline size_t
+SpikeHistory::capacity() const
+{
+  return buffer_.size();
+}
+
+inline histentry& SpikeHistory::operator[]( const size_t i )
+{
+  assert( i < size_ );
+  return buffer_[ ( head_ + i ) & ( buffer_.size() - 1 ) ];
+}
+
+inline const histentry& SpikeHistory::operator[]( const size_t i ) const
+{
+  assert( i < size_ );
+  return buffer_[ ( head_ + i ) & ( buffer_.size() - 1 ) ];
+}
+
+inline histentry&
+SpikeHistory::front()
+{
+  return ( *this )[ 0 ];
+}
+
+inline histentry&
+SpikeHistory::back()
+{
+  return ( *this )[ size_ - 1 ];
+}
+
+inline SpikeHistory::iterator
+SpikeHistory::begin()
+{
+  return iterator( this, 0 );
+}
+
+inline SpikeHistory::iterator
+SpikeHistory::end()
+{
+  return iterator( this, size_ );
+}
+
+inline bool
+SpikeHistory::is_before_( const histentry& entry, const double t )
+{
+  return entry.t_ < t;
+}
+
+inline SpikeHistory::iterator
+SpikeHistory::lower_bound( const double t )
+{
+  return std::lower_bound( begin(), end(), t, is_before_ );
+}
+
+inline void
+SpikeHistory::push_back( const histentry& entry )
+{
+  if ( size_ == buffer_.size() )
+  {
+    grow_();
+  }
+  ++size_;
+  back() = entry;
+}
+
+inline void
+SpikeHistory::pop_front()
+{
+  assert( size_ > 0 );
+  head_ = ( head_ + 1 ) & ( buffer_.size() - 1 );
+  --size_;
+}
+
+inline void
+SpikeHistory::clear()
+{
+  head_ = 0;
+  size_ = 0;
+}
+
+inline void
+SpikeHistory::grow_()
+{
+  const size_t capacity =
+    buffer_.empty() ? min_capacity_ : 2 * buffer_.size();
+  std::vector< histentry > buffer( capacity, histentry( 0.0, 0.0, 0.0, 0 ) );
+  for ( size_t i = 0; i < size_; ++i )
+  {
+    buffer[ i ] = ( *this )[ i ];
+  }
+  buffer_.swap( buffer );
+  head_ = 0;
+}
+
+} // namespace nest
+
+#endif /* SPIKE_HISTORY_H */
@@ -31,6 +31,7 @@
 #include "nest_time.h"
 #include "nest_types.h"
 #include "recordables_map.h"
+#include "sampling_buffer.h"
 
 namespace nest
 {
@@ -70,6 +71,10 @@ namespace nest
  * DataLoggingRequests should then be forwarded to the logger using
  * handle().
  *
+ * If the multimeter passes a SamplingBuffer with the request used for
+ * connecting, the logger writes its samples directly into that buffer
+ * and DataLoggingRequests received during simulation are not answered.
+ *
  * @note A reference to the host node is stored in the logger, for
  *       access to the state and sending events. This requires a constructor
  *       and a copy constructor for the HostNode::Buffers_, creating new
@@ -155,6 +160,9 @@ public:
    */
   void record_data( long );
 
+  //! Return true if at least one multimeter is connected
+  bool is_recording() const;
+
   //! Erase all existing data
   void reset();
 
@@ -185,6 +193,9 @@ private:
     void reset();
     void init();
 
+    //! Write samples directly to the buffer of the multimeter
+    void set_sampling_buffer( SamplingBuffer&, const index );
+
   private:
     index multimeter_; //!< GID of multimeter for which the logger works
     size_t num_vars_;  //!< number of variables recorded
@@ -209,6 +220,12 @@ private:
 
     //! Next buffer entry to write to, with read/write toggle
     std::vector< size_t > next_rec_;
+
+    //! Buffer of multimeter to write to, 0 if data_ is used
+    SamplingBuffer* sampling_buffer_;
+
+    //! Index of host node in sampling_buffer_
+    size_t sampling_buffer_node_;
   };
 
   HostNode& host_; //!< node to which logger belongs
@@ -263,10 +280,24 @@ nest::UniversalDataLogger< HostNode >::connect_logging_device(
   // create one and push it
   data_loggers_.push_back( DataLogger_( req, rmap ) );
 
+  // if the multimeter provides a buffer, write samples directly to it
+  if ( req.get_sampling_buffer() != 0 )
+  {
+    data_loggers_.back().set_sampling_buffer(
+      *req.get_sampling_buffer(), host_.get_gid() );
+  }
+
   // rport is index plus one, i.e., size
   return data_loggers_.size();
 }
 
+template < typename HostNode >
+inline bool
+nest::UniversalDataLogger< HostNode >::is_recording() const
+{
+  return not data_loggers_.empty();
+}
+
 template < typename HostNode >
 nest::UniversalDataLogger< HostNode >::DataLogger_::DataLogger_(
   const DataLoggingRequest& req,
@@ -281,6 +312,8 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::DataLogger_(
   node_access_()
   , data_()
   , next_rec_( 2, 0 )
+  , sampling_buffer_( 0 )
+  , sampling_buffer_node_( 0 )
 {
   const std::vector< Name >& recvars = req.record_from();
   for ( size_t j = 0; j < recvars.size(); ++j )
@@ -315,6 +348,21 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::DataLogger_(
   recording_offset_ = req.get_recording_offset();
 }
 
+template < typename HostNode >
+void
+nest::UniversalDataLogger< HostNode >::DataLogger_::set_sampling_buffer(
+  SamplingBuffer& buffer,
+  const index gid )
+{
+  if ( num_vars_ < 1 )
+  {
+    return;
+  } // not recording anything
+
+  sampling_buffer_ = &buffer;
+  sampling_buffer_node_ = buffer.add_node( gid, num_vars_ );
+}
+
 
 /**
  * Dynamic Universal data-logging plug-in for multisynapse neuron models.
@@ -337,6 +385,10 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::DataLogger_(
  * DataLoggingRequests should then be forwarded to the logger using
  * handle().
  *
+ * If the multimeter passes a SamplingBuffer with the request used for
+ * connecting, the logger writes its samples directly into that buffer
+ * and DataLoggingRequests received during simulation are not answered.
+ *
  * @note A reference to the host node is stored in the logger, for
  *       access to the state and sending events. This requires a constructor
  *       and a copy constructor for the HostNode::Buffers_, creating new
@@ -457,6 +509,9 @@ private:
     void reset();
     void init();
 
+    //! Write samples directly to the buffer of the multimeter
+    void set_sampling_buffer( SamplingBuffer&, const index );
+
   private:
     index multimeter_; //!< GID of multimeter for which the logger works
     size_t num_vars_;  //!< number of variables recorded
@@ -481,6 +536,12 @@ private:
 
     //! Next buffer entry to write to, with read/write toggle
     std::vector< size_t > next_rec_;
+
+    //! Buffer of multimeter to write to, 0 if data_ is used
+    SamplingBuffer* sampling_buffer_;
+
+    //! Index of host node in sampling_buffer_
+    size_t sampling_buffer_node_;
   };
 
   HostNode& host_; //!< node to which logger belongs
@@ -537,6 +598,13 @@ nest::DynamicUniversalDataLogger< HostNode >::connect_logging_device(
   // create one and push it
   data_loggers_.push_back( DataLogger_( req, rmap ) );
 
+  // if the multimeter provides a buffer, write samples directly to it
+  if ( req.get_sampling_buffer() != 0 )
+  {
+    data_loggers_.back().set_sampling_buffer(
+      *req.get_sampling_buffer(), host_.get_gid() );
+  }
+
   // rport is index plus one, i.e., size
   return data_loggers_.size();
 }
@@ -555,6 +623,8 @@ nest::DynamicUniversalDataLogger< HostNode >::DataLogger_::DataLogger_(
   node_access_()
   , data_()
   , next_rec_( 2, 0 )
+  , sampling_buffer_( 0 )
+  , sampling_buffer_node_( 0 )
 {
   const std::vector< Name >& recvars = req.record_from();
   for ( size_t j = 0; j < recvars.size(); ++j )
@@ -588,6 +658,21 @@ nest::DynamicUniversalDataLogger< HostNode >::DataLogger_::DataLogger_(
   recording_interval_ = req.get_recording_interval();
   recording_offset_ = req.get_recording_offset();
 }
+
+template < typename HostNode >
+void
+nest::DynamicUniversalDataLogger< HostNode >::DataLogger_::set_sampling_buffer(
+  SamplingBuffer& buffer,
+  const index gid )
+{
+  if ( num_vars_ < 1 )
+  {
+    return;
+  } // not recording anything
+
+  sampling_buffer_ = &buffer;
+  sampling_buffer_node_ = buffer.add_node( gid, num_vars_ );
+}
 }
 
 #endif // UNIVERSAL_DATA_LOGGER_H
@@ -131,6 +131,12 @@ nest::DynamicUniversalDataLogger< HostNode >::DataLogger_::init()
       next_rec_step_ - rec_int_steps_ + recording_offset_.get_steps();
   }
 
+  // samples are written to the buffer of the multimeter if it provides one
+  if ( sampling_buffer_ != 0 )
+  {
+    return;
+  }
+
   // number of data points per slice
   const long recs_per_slice =
     static_cast< long >( std::ceil( kernel().connection_manager.get_min_delay()
@@ -157,6 +163,19 @@ nest::DynamicUniversalDataLogger< HostNode >::DataLogger_::record_data(
 
   const size_t wt = kernel().event_delivery_manager.write_toggle();
 
+  if ( sampling_buffer_ != 0 )
+  {
+    // step is left end of update interval, so add 1 for time stamp
+    double* const dest = sampling_buffer_->add_sample(
+      wt, sampling_buffer_node_, Time::step( step + 1 ) );
+    for ( size_t j = 0; j < num_vars_; ++j )
+    {
+      dest[ j ] = ( *( node_access_[ j ] ) )();
+    }
+    next_rec_step_ += rec_int_steps_;
+    return;
+  }
+
   assert( wt < next_rec_.size() );
   assert( wt < data_.size() );
 
@@ -196,10 +215,10 @@ nest::DynamicUniversalDataLogger< HostNode >::DataLogger_::handle(
   HostNode& host,
   const DataLoggingRequest& request )
 {
-  if ( num_vars_ < 1 )
+  if ( num_vars_ < 1 or sampling_buffer_ != 0 )
   {
     return;
-  } // nothing to do
+  } // nothing to do, or multimeter reads samples from sampling_buffer_
 
   // The following assertions will fire if the user forgot to call init()
   // on the data logger.
@@ -344,6 +363,12 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::init()
       next_rec_step_ - rec_int_steps_ + recording_offset_.get_steps();
   }
 
+  // samples are written to the buffer of the multimeter if it provides one
+  if ( sampling_buffer_ != 0 )
+  {
+    return;
+  }
+
   // number of data points per slice
   const long recs_per_slice =
     static_cast< long >( std::ceil( kernel().connection_manager.get_min_delay()
@@ -370,6 +395,19 @@ nest::UniversalDataLogger< HostNode >::DataLogger_::record_data(
 
   const size_t wt = kernel().event_delivery_manager.write_toggle();
 
+  if ( sampling_buffer_ != 0 )
+  {
+    // step is left end of update interval, so add 1 for time stamp
+    double* const dest = sampling_buffer_->add_sample(
+      wt, sampling_buffer_node_, Time::step( step + 1 ) );
+    for ( size_t j = 0; j < num_vars_; ++j )
+    {
+      dest[ j ] = ( ( host ).*( node_access_[ j ] ) )();
+    }
+    next_rec_step_ += rec_int_steps_;
+    return;
+  }
+
   assert( wt < next_rec_.size() );
   assert( wt < data_.size() );
 
@@ -408,10 +446,10 @@ void
 nest::UniversalDataLogger< HostNode >::DataLogger_::handle( HostNode& host,
   const DataLoggingRequest& request )
 {
-  if ( num_vars_ < 1 )
+  if ( num_vars_ < 1 or sampling_buffer_ != 0 )
   {
     return;
-  } // nothing to do
+  } // nothing to do, or multimeter reads samples from sampling_buffer_
 
   // The following assertions will fire if the user forgot to call init()
   // on the data logger.
@@ -24,6 +24,7 @@
 
 // Includes from libnestutil:
 #include "logging.h"
+#include "numa_utils.h"
 
 // Includes from nestkernel:
 #include "kernel_manager.h"
@@ -206,6 +207,14 @@ nest::VPManager::get_status( DictionaryDatum& d )
 {
   def< long >( d, names::local_num_threads, get_num_threads() );
   def< long >( d, names::total_num_virtual_procs, get_num_virtual_processes() );
+
+  std::vector< long > thread_numa_nodes( get_num_threads(), -1 );
+#pragma omp parallel
+  {
+    thread_numa_nodes[ get_thread_id() ] = numa_node_of_current_cpu();
+  }
+  ArrayDatum thread_numa_nodes_ad( thread_numa_nodes );
+  def< ArrayDatum >( d, names::thread_numa_nodes, thread_numa_nodes_ad );
 }
 
 void
@@ -0,0 +1,195 @@
+# -*- coding: utf-8 -*-
+#
+# columnar.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Functions to read files written by recording devices in columnar format.
+
+Recording devices write this format if /file_format is set to /columnar.
+The data of each chunk of a file is memory-mapped, so that reading a file
+does not copy the data unless several chunks have to be concatenated.
+"""
+
+import struct
+
+import numpy
+
+__all__ = [
+    'read_header',
+    'iter_chunks',
+    'load',
+    'times_ms',
+]
+
+_MAGIC = b'NESTCOL\0'
+_BYTE_ORDER_MARK = 0x01020304
+_TYPES = {
+    b'u': 'u8',
+    b'i': 'i8',
+    b'd': 'f8',
+    b'f': 'f4',
+}
+
+
+def read_header(fname):
+    """Read the header of a columnar file.
+
+    Parameters
+    ----------
+    fname : str
+        Name of the file
+
+    Returns
+    -------
+    dict:
+        Dictionary with keys 'version', 'byteorder' ('<' or '>'),
+        'resolution' (in ms), 'columns' (list of pairs of column name and
+        numpy dtype) and 'size' (size of the header in bytes)
+
+    Raises
+    ------
+    ValueError
+        If the file is not in columnar format
+    """
+
+    with open(fname, 'rb') as f:
+        magic = f.read(8)
+        if magic != _MAGIC:
+            raise ValueError("'%s' is not a columnar file." % fname)
+
+        # determine byte order of the writing machine from the marker
+        version, bom = f.read(4), f.read(4)
+        for order in '<>':
+            if struct.unpack(order + 'I', bom)[0] == _BYTE_ORDER_MARK:
+                break
+        else:
+            raise ValueError("'%s' has an invalid byte order mark." % fname)
+        version = struct.unpack(order + 'I', version)[0]
+
+        resolution, n_columns = struct.unpack(order + 'dI', f.read(12))
+
+        columns = []
+        for _ in range(n_columns):
+            code, length = struct.unpack('cB', f.read(2))
+            name = f.read(length).decode('ascii')
+            columns.append((name, numpy.dtype(order + _TYPES[code])))
+
+        return {'version': version,
+                'byteorder': order,
+                'resolution': resolution,
+                'columns': columns,
+                'size': f.tell()}
+
+
+def iter_chunks(fname):
+    """Iterate over the chunks of a columnar file.
+
+    Parameters
+    ----------
+    fname : str
+        Name of the file
+
+    Yields
+    ------
+    dict:
+        Dictionary mapping column names to memory-mapped numpy arrays
+        holding the values of the chunk
+    """
+
+    header = read_header(fname)
+    columns = header['columns']
+    row_count = numpy.dtype(header['byteorder'] + 'u8')
+
+    data = numpy.memmap(fname, dtype='u1', mode='r')
+    pos = header['size']
+    while pos < data.size:
+        n_rows = int(data[pos:pos + 8].view(row_count)[0])
+        pos += 8
+        chunk = {}
+        for name, dtype in columns:
+            size = n_rows * dtype.itemsize
+            chunk[name] = data[pos:pos + size].view(dtype)
+            pos += size
+        yield chunk
+
+
+def load(fname):
+    """Read one or more columnar files.
+
+    Parameters
+    ----------
+    fname : str or list
+        Name of the file or list of names of files, e.g., the files written
+        by the instances of a recording device on all virtual processes.
+        All files must contain the same columns.
+
+    Returns
+    -------
+    dict:
+        Dictionary mapping column names to numpy arrays. If the data consist
+        of a single chunk, the arrays are memory-mapped from the file.
+    """
+
+    if isinstance(fname, str):
+        fname = [fname]
+
+    chunks = []
+    names = None
+    for f in fname:
+        header = read_header(f)
+        if names is None:
+            names = [name for name, _ in header['columns']]
+        elif names != [name for name, _ in header['columns']]:
+            raise ValueError("'%s' contains different columns." % f)
+        chunks.extend(iter_chunks(f))
+
+    if names is None:
+        return {}
+    if len(chunks) == 1:
+        return chunks[0]
+
+    dtypes = dict(header['columns'])
+    if not chunks:
+        return dict((name, numpy.empty(0, dtype=dtypes[name]))
+                    for name in names)
+    return dict((name, numpy.concatenate([c[name] for c in chunks]))
+                for name in names)
+
+
+def times_ms(data, resolution):
+    """Compute times in ms from the steps and offsets of a columnar file.
+
+    Parameters
+    ----------
+    data : dict
+        Dictionary as returned by load() or iter_chunks()
+    resolution : float
+        Simulation resolution in ms, see read_header()
+
+    Returns
+    -------
+    numpy.ndarray:
+        Times of the records in ms
+    """
+
+    times = data['steps'] * resolution
+    if 'offsets' in data:
+        times = times - data['offsets']
+    return times
@@ -55,6 +55,7 @@ from . import test_rate_neuron
 from . import test_rate_neuron_communication
 from . import test_siegert_neuron
 from . import test_use_gid_in_filename
+from . import test_columnar
 
 
 def suite():
@@ -92,6 +93,7 @@ def suite():
     suite.addTest(test_rate_neuron_communication.suite())
     suite.addTest(test_siegert_neuron.suite())
     suite.addTest(test_use_gid_in_filename.suite())
+    suite.addTest(test_columnar.suite())
 
     return suite
 
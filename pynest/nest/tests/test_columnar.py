@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+#
+# test_columnar.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test reading files written by recording devices in columnar format
+"""
+
+import unittest
+import nest
+import nest.columnar
+import numpy
+
+
+@nest.check_stack
+class ColumnarTestCase(unittest.TestCase):
+    """Tests of nest.columnar"""
+
+    def test_SpikeDetector(self):
+        """Spikes in columnar file equal spikes in memory"""
+
+        nest.ResetKernel()
+        nest.SetKernelStatus({'overwrite_files': True})
+
+        pg = nest.Create('poisson_generator_ps', 1, {'rate': 1000.})
+        sd = nest.Create('spike_detector', 1,
+                         {'to_file': True, 'file_format': 'columnar',
+                          'precise_times': True, 'withweight': True})
+        nest.Connect(pg, sd)
+
+        # two calls to Simulate write two chunks
+        nest.Simulate(50.)
+        nest.Simulate(50.)
+
+        fname = nest.GetStatus(sd, 'filenames')[0][0]
+        header = nest.columnar.read_header(fname)
+        self.assertEqual([c for c, _ in header['columns']],
+                         ['senders', 'steps', 'offsets', 'weights'])
+        self.assertEqual(header['resolution'],
+                         nest.GetKernelStatus('resolution'))
+
+        data = nest.columnar.load(fname)
+        events = nest.GetStatus(sd, 'events')[0]
+        self.assertTrue(numpy.all(data['senders'] == events['senders']))
+        self.assertTrue(numpy.allclose(
+            nest.columnar.times_ms(data, header['resolution']),
+            events['times']))
+        self.assertTrue(numpy.all(data['weights'] == events['weights']))
+
+    def test_Multimeter(self):
+        """Values in columnar file equal values in memory"""
+
+        nest.ResetKernel()
+        nest.SetKernelStatus({'overwrite_files': True})
+
+        n = nest.Create('iaf_psc_alpha', 2, {'I_e': 500.})
+        mm = nest.Create('multimeter', 1,
+                         {'to_file': True, 'file_format': 'columnar',
+                          'single_precision': True, 'withgid': True,
+                          'interval': 1., 'record_from': ['V_m', 'I_syn_ex']})
+        nest.Connect(mm, n)
+        nest.Simulate(100.)
+
+        fname = nest.GetStatus(mm, 'filenames')[0][0]
+        data = nest.columnar.load(fname)
+        events = nest.GetStatus(mm, 'events')[0]
+        self.assertEqual(data['V_m'].dtype, numpy.float32)
+        self.assertTrue(numpy.all(data['senders'] == events['senders']))
+        self.assertTrue(numpy.allclose(data['V_m'], events['V_m']))
+        self.assertTrue(numpy.allclose(data['I_syn_ex'], events['I_syn_ex']))
+
+
+def suite():
+    suite = unittest.makeSuite(ColumnarTestCase, 'test')
+    return suite
+
+
+def run():
+    runner = unittest.TextTestRunner(verbosity=2)
+    runner.run(suite())
+
+
+if __name__ == "__main__":
+    run()
@@ -25,6 +25,7 @@
 #include <boost/test/unit_test.hpp>
 
 // Includes from cpptests
+#include "test_philox.h"
 #include "test_sort.h"
 #include "test_target_fields.h"
 #include "test_block_vector.h"
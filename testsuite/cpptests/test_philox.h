@@ -0,0 +1,174 @@
+/*
+ *  test_philox.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_PHILOX_H
+#define TEST_PHILOX_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <cmath>
+#include <vector>
+
+// Includes from librandom:
+#include "philox.h"
+
+namespace nest
+{
+
+/**
+ * Computes mean and variance of the given numbers.
+ */
+template < typename T >
+void
+mean_and_variance( const std::vector< T >& x, double& mean, double& var )
+{
+  mean = 0.0;
+  for ( size_t i = 0; i < x.size(); ++i )
+  {
+    mean += x[ i ];
+  }
+  mean /= x.size();
+
+  var = 0.0;
+  for ( size_t i = 0; i < x.size(); ++i )
+  {
+    var += ( x[ i ] - mean ) * ( x[ i ] - mean );
+  }
+  var /= x.size() - 1;
+}
+
+BOOST_AUTO_TEST_SUITE( test_philox )
+
+/**
+ * Tests whether fill_uniform() yields the same numbers as repeated calls
+ * to drand(), also if the fill starts and ends within a block of four
+ * numbers and spans several chunks of blocks.
+ */
+BOOST_AUTO_TEST_CASE( test_fill_uniform )
+{
+  librandom::Philox rng_drand( 12345 );
+  librandom::Philox rng_fill( 12345 );
+
+  const size_t sizes[] = { 1, 2, 7, 256, 1001, 3 };
+  for ( size_t s = 0; s < sizeof( sizes ) / sizeof( size_t ); ++s )
+  {
+    std::vector< double > x( sizes[ s ] );
+    rng_fill.fill_uniform( &x[ 0 ], x.size() );
+    for ( size_t i = 0; i < x.size(); ++i )
+    {
+      BOOST_REQUIRE( x[ i ] == rng_drand.drand() );
+    }
+  }
+}
+
+/**
+ * Tests mean and variance of standard normal numbers, for an odd number
+ * of numbers.
+ */
+BOOST_AUTO_TEST_CASE( test_fill_normal )
+{
+  librandom::Philox rng( 42 );
+  std::vector< double > x( 100001 );
+  rng.fill_normal( &x[ 0 ], x.size() );
+
+  double mean;
+  double var;
+  mean_and_variance( x, mean, var );
+  BOOST_REQUIRE( std::abs( mean ) < 0.01 );
+  BOOST_REQUIRE( std::abs( var - 1.0 ) < 0.02 );
+}
+
+/**
+ * Tests mean and variance of Poisson numbers for small lambda, drawn by
+ * inversion, and large lambda, drawn by transformed rejection.
+ */
+BOOST_AUTO_TEST_CASE( test_fill_poisson )
+{
+  librandom::Philox rng( 42 );
+  const double lambdas[] = { 0.5, 5.0, 20.0, 1000.0 };
+  for ( size_t l = 0; l < sizeof( lambdas ) / sizeof( double ); ++l )
+  {
+    const double lambda = lambdas[ l ];
+    std::vector< long > k( 100000 );
+    rng.fill_poisson( &k[ 0 ], k.size(), lambda );
+
+    double mean;
+    double var;
+    mean_and_variance( k, mean, var );
+    BOOST_REQUIRE( std::abs( mean - lambda ) < 0.02 * lambda + 0.01 );
+    BOOST_REQUIRE( std::abs( var - lambda ) < 0.05 * lambda + 0.01 );
+  }
+}
+
+/**
+ * Tests that streams for different virtual processes and purposes
+ * differ from each other, and that selecting a stream restarts it.
+ */
+BOOST_AUTO_TEST_CASE( test_set_stream )
+{
+  const size_t n = 1000;
+  std::vector< std::vector< double > > x;
+  librandom::Philox rng( 7 );
+  for ( unsigned long vp = 0; vp < 2; ++vp )
+  {
+    for ( unsigned long purpose = 0; purpose < 2; ++purpose )
+    {
+      rng.set_stream( vp, purpose );
+      x.push_back( std::vector< double >( n ) );
+      rng.fill_uniform( &x.back()[ 0 ], n );
+    }
+  }
+
+  // streams are uncorrelated
+  for ( size_t a = 0; a < x.size(); ++a )
+  {
+    for ( size_t b = a + 1; b < x.size(); ++b )
+    {
+      double cov = 0.0;
+      size_t num_equal = 0;
+      for ( size_t i = 0; i < n; ++i )
+      {
+        cov += ( x[ a ][ i ] - 0.5 ) * ( x[ b ][ i ] - 0.5 );
+        num_equal += x[ a ][ i ] == x[ b ][ i ];
+      }
+      // standard deviation of the correlation coefficient is 1/sqrt(n)
+      BOOST_REQUIRE( std::abs( 12.0 * cov / n ) < 5.0 / std::sqrt( n ) );
+      BOOST_REQUIRE( num_equal == 0 );
+    }
+  }
+
+  // selecting a stream again restarts it, independently of the seed
+  // state reached before
+  rng.set_stream( 1, 0 );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    BOOST_REQUIRE( rng.drand() == x[ 2 ][ i ] );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // of namespace nest
+
+#endif /* TEST_PHILOX_H */
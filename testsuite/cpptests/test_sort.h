@@ -88,6 +88,29 @@ BOOST_AUTO_TEST_CASE( test_random )
   BOOST_REQUIRE( is_sorted( bv1.begin(), bv1.end() ) );
 }
 
+/**
+ * Tests whether two arrays with large random numbers, which require
+ * several radix passes, are sorted correctly by a single call to sort.
+ */
+BOOST_AUTO_TEST_CASE( test_random_large )
+{
+  const size_t N = 20000;
+  BlockVector< size_t > bv0( N );
+  BlockVector< size_t > bv1( N );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    const size_t k = static_cast< size_t >( std::rand() ) << 20 ^ std::rand();
+    bv0[ i ] = k;
+    bv1[ i ] = k;
+  }
+
+  nest::sort( bv0, bv1 );
+
+  BOOST_REQUIRE( is_sorted( bv0.begin(), bv0.end() ) );
+  BOOST_REQUIRE( is_sorted( bv1.begin(), bv1.end() ) );
+}
+
 /**
  * Tests whether two arrays with linearly increasing numbers are sorted
  * correctly by a single call to sort.
@@ -110,6 +133,74 @@ BOOST_AUTO_TEST_CASE( test_linear )
   BOOST_REQUIRE( is_sorted( bv1.begin(), bv1.end() ) );
 }
 
+/**
+ * Tests whether entries appended to a sorted array are merged correctly
+ * into the sorted part, and whether original entries precede appended
+ * entries that are equal to them.
+ */
+BOOST_AUTO_TEST_CASE( test_incremental )
+{
+  const size_t N = 20000;
+  const size_t N_new = 1000;
+  BlockVector< size_t > bv0( N );
+  BlockVector< size_t > bv1( N );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    bv0[ i ] = i / 4;
+    bv1[ i ] = i;
+  }
+  for ( size_t i = 0; i < N_new; ++i )
+  {
+    const size_t k = std::rand() % N;
+    bv0.push_back( k );
+    bv1.push_back( N + i );
+  }
+
+  nest::sort( bv0, bv1 );
+
+  BOOST_REQUIRE( is_sorted( bv0.begin(), bv0.end() ) );
+  for ( size_t i = 1; i < bv0.size(); ++i )
+  {
+    // original entries precede appended ones, see bv1
+    BOOST_REQUIRE( bv0[ i - 1 ] < bv0[ i ] or bv1[ i - 1 ] < N
+      or bv1[ i ] >= N );
+  }
+}
+
+/**
+ * Tests whether entries appended to a sorted array are sorted as a
+ * separate segment, leaving the entries in front of it in place.
+ */
+BOOST_AUTO_TEST_CASE( test_sort_from )
+{
+  const size_t N = 20000;
+  const size_t N_new = 1000;
+  BlockVector< size_t > bv0( N );
+  BlockVector< size_t > bv1( N );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    bv0[ i ] = i / 4;
+    bv1[ i ] = i;
+  }
+  for ( size_t i = 0; i < N_new; ++i )
+  {
+    const size_t k = std::rand() % N;
+    bv0.push_back( k );
+    bv1.push_back( k );
+  }
+
+  nest::sort_from( bv0, bv1, N );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    BOOST_REQUIRE( bv0[ i ] == i / 4 and bv1[ i ] == i );
+  }
+  BOOST_REQUIRE( is_sorted( bv0.begin() + N, bv0.end() ) );
+  BOOST_REQUIRE( is_sorted( bv1.begin() + N, bv1.end() ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // of namespace nest